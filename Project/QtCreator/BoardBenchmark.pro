@@ -0,0 +1,23 @@
+#-------------------------------------------------
+#
+# board-benchmark times the hot paths of the Board,
+# and counts their heap allocations per call.
+#
+#-------------------------------------------------
+
+QT       += core gui testlib
+
+greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
+
+TARGET = board-benchmark
+TEMPLATE = app
+
+CONFIG   += console
+CONFIG   -= app_bundle
+
+include(Engine.pri)
+
+include(Game.pri)
+
+SOURCES += \
+    ../../Source/Tools/BoardBenchmark.cpp
@@ -13,50 +13,24 @@ TEMPLATE = app
 
 INCLUDEPATH+= ../../Source
 
-SOURCES += \
-           ../../Source/main.cpp \
-           ../../Source/Chess.cpp \
-           ../../Source/Board.cpp \
-           ../../Source/Cell.cpp \
-           ../../Source/Piece.cpp \
-           ../../Source/StyleSheetProcessor.cpp \
-    ../../Source/MoveRules.cpp \
-    ../../Source/Player.cpp \
-    ../../Source/TurnManager.cpp \
-    ../../Source/MoveGenerator.cpp \
-    ../../Source/PixmapWidget.cpp \
-    ../../Source/CapturedPieceWidget.cpp \
-    ../../Source/AppFilter.cpp \
-    ../../Source/MoveMapper.cpp
+include(Engine.pri)
+
+include(Game.pri)
 
-HEADERS  += \
-    ../../Source/Chess.h \
-    ../../Source/Board.h \
-    ../../Source/Cell.h \
-    ../../Source/Piece.h \
-    ../../Source/Pieces.h \
-    ../../Source/Colors.h \
-    ../../Source/StyleSheetProcessor.h \
-    ../../Source/UserIdentity.h \
-    ../../Source/MoveRules.h \
-    ../../Source/Player.h \
-    ../../Source/TurnManager.h \
-    ../../Source/MoveGenerator.h \
-    ../../Source/PixmapWidget.h \
-    ../../Source/CapturedPieceWidget.h \
-    ../../Source/AppFilter.h \
-    ../../Source/MoveMapper.h \
-    ../../Source/CommonTypeDefinitions.h \
-    ../../Source/Direction.h \
-    ../../Source/Magnitude.h \
-    ../../Source/StyleComponents.h
+# Counts the allocations of every turn per subsystem, shown over the board and logged to allocations.csv.
+# Opt in with: qmake "CONFIG+=allocation_tracking"
+allocation_tracking {
+    DEFINES += CHESS_TRACK_ALLOCATIONS
+}
 
-FORMS    += ../../Source/Chess.ui \
-            ../../Source/Board.ui \
-    ../../Source/CapturedPieceWidget.ui
+# Records the scopes a turn goes through to turns.trace.json, for chrome://tracing or ui.perfetto.dev.
+# Opt in with: qmake "CONFIG+=turn_tracing"
+turn_tracing {
+    DEFINES += CHESS_TRACE_TURNS
+}
 
-RESOURCES += \
-    ../chess.qrc
+SOURCES += \
+           ../../Source/main.cpp
 
 DISTFILES += \
     android/gradle/wrapper/gradle-wrapper.jar \
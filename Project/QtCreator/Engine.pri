@@ -0,0 +1,34 @@
+#-------------------------------------------------
+#
+# The headless part of the game: board state, move
+# generation, game history and search.  Shared by the
+# game and the console tools, none of it needs widgets.
+#
+#-------------------------------------------------
+
+INCLUDEPATH += $$PWD/../../Source
+
+SOURCES += \
+    $$PWD/../../Source/BitBoards.cpp \
+    $$PWD/../../Source/GameState.cpp \
+    $$PWD/../../Source/LegalMoveGenerator.cpp \
+    $$PWD/../../Source/GameHistory.cpp \
+    $$PWD/../../Source/MovePicker.cpp \
+    $$PWD/../../Source/Evaluation.cpp \
+    $$PWD/../../Source/TranspositionTable.cpp \
+    $$PWD/../../Source/Search.cpp
+
+HEADERS += \
+    $$PWD/../../Source/Pieces.h \
+    $$PWD/../../Source/Colors.h \
+    $$PWD/../../Source/CommonTypeDefinitions.h \
+    $$PWD/../../Source/Direction.h \
+    $$PWD/../../Source/CastlingRights.h \
+    $$PWD/../../Source/BitBoards.h \
+    $$PWD/../../Source/GameState.h \
+    $$PWD/../../Source/LegalMoveGenerator.h \
+    $$PWD/../../Source/GameHistory.h \
+    $$PWD/../../Source/MovePicker.h \
+    $$PWD/../../Source/Evaluation.h \
+    $$PWD/../../Source/TranspositionTable.h \
+    $$PWD/../../Source/Search.h
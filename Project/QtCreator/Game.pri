@@ -0,0 +1,49 @@
+#-------------------------------------------------
+#
+# The widgets of the game: the board, its squares and
+# pieces, and the players taking turns on it.  Shared
+# by the game and the benchmarks of the board.
+#
+#-------------------------------------------------
+
+QT += svg
+
+# The widgets build with warnings on, and -Wextra too where the compiler is not MSVC.
+CONFIG += warn_on
+!msvc: QMAKE_CXXFLAGS_WARN_ON += -Wextra
+
+INCLUDEPATH += $$PWD/../../Source
+
+SOURCES += \
+           $$PWD/../../Source/Chess.cpp \
+           $$PWD/../../Source/Board.cpp \
+           $$PWD/../../Source/BoardView.cpp \
+           $$PWD/../../Source/PiecePixmapCache.cpp \
+    $$PWD/../../Source/Player.cpp \
+    $$PWD/../../Source/TurnManager.cpp \
+    $$PWD/../../Source/MoveGenerator.cpp \
+    $$PWD/../../Source/CapturedPiecesStrip.cpp \
+    $$PWD/../../Source/MoveMapper.cpp \
+    $$PWD/../../Source/AllocationTracker.cpp \
+    $$PWD/../../Source/TurnTracer.cpp
+
+HEADERS  += \
+    $$PWD/../../Source/Chess.h \
+    $$PWD/../../Source/Board.h \
+    $$PWD/../../Source/BoardView.h \
+    $$PWD/../../Source/PiecePixmapCache.h \
+    $$PWD/../../Source/UserIdentity.h \
+    $$PWD/../../Source/Player.h \
+    $$PWD/../../Source/TurnManager.h \
+    $$PWD/../../Source/MoveGenerator.h \
+    $$PWD/../../Source/CapturedPiecesStrip.h \
+    $$PWD/../../Source/MoveMapper.h \
+    $$PWD/../../Source/EndGameConditions.h \
+    $$PWD/../../Source/AllocationTracker.h \
+    $$PWD/../../Source/TurnTracer.h
+
+FORMS    += $$PWD/../../Source/Chess.ui \
+            $$PWD/../../Source/Board.ui
+
+RESOURCES += \
+    $$PWD/../chess.qrc
@@ -0,0 +1,20 @@
+#-------------------------------------------------
+#
+# perft counts the leaf positions of well known
+# positions, to verify and time the move generator.
+#
+#-------------------------------------------------
+
+QT       += core
+QT       -= gui
+
+TARGET = perft
+TEMPLATE = app
+
+CONFIG   += console
+CONFIG   -= app_bundle
+
+include(Engine.pri)
+
+SOURCES += \
+    ../../Source/Tools/Perft.cpp
@@ -0,0 +1,24 @@
+#-------------------------------------------------
+#
+# chess-uci plays through the Universal Chess
+# Interface, for tournament managers and GUIs.
+#
+#-------------------------------------------------
+
+QT       += core
+QT       -= gui
+
+TARGET = chess-uci
+TEMPLATE = app
+
+CONFIG   += console
+CONFIG   -= app_bundle
+
+include(Engine.pri)
+
+SOURCES += \
+    ../../Source/Tools/Uci.cpp \
+    ../../Source/Tools/Bench.cpp
+
+HEADERS += \
+    ../../Source/Tools/Bench.h
@@ -0,0 +1,240 @@
+///
+/// \file   AllocationTracker.cpp
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This cpp file contains the body functionality of the AllocationTracker class, and, in builds that
+/// define CHESS_TRACK_ALLOCATIONS, the allocator hooks that feed it.
+///
+/// The counters are plain old data, so that they are usable by the very first allocation of the process,
+/// long before any constructor has run.
+///
+
+#include "AllocationTracker.h"
+
+#include <QAtomicInteger>
+#include <QDir>
+#include <QFile>
+#include <QTextStream>
+#include <QThread>
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+  ///
+  /// currentSubsystem is the subsystem allocations are counted for.
+  ///
+  AllocationSubsystems::eAllocationSubsystems currentSubsystem = AllocationSubsystems::eOther;
+
+  ///
+  /// allocationCounts holds the number of allocations each subsystem made during the turn being counted.
+  ///
+  QBasicAtomicInteger<qint64> allocationCounts[AllocationSubsystems::eMax + 1];
+
+  ///
+  /// byteCounts holds the number of bytes each subsystem asked for during the turn being counted.
+  ///
+  QBasicAtomicInteger<qint64> byteCounts[AllocationSubsystems::eMax + 1];
+
+  ///
+  /// trackedThread is the thread whose allocations are counted by subsystem, none until the tracker is created.
+  ///
+  Qt::HANDLE trackedThread = 0;
+
+  ///
+  /// suspended is true while the tracker writes its log, so that it does not count itself.  Only the tracked thread uses it.
+  ///
+  bool suspended = false;
+}
+
+AllocationTracker::AllocationTracker(QObject* parent) :
+  QObject(parent),
+  _turnNumber(0),
+  _turnColor(PieceColors::eNone)
+{
+  for (int subsystem = AllocationSubsystems::eInit; subsystem <= AllocationSubsystems::eMax; ++subsystem) {
+    _lastTurn[subsystem].allocations = 0;
+    _lastTurn[subsystem].bytes = 0;
+  }
+
+  QByteArray logPath = qgetenv("CHESS_ALLOCATION_LOG");
+  _logPath = logPath.isEmpty() ? QDir::current().filePath(QString("allocations.csv")) : QString::fromLocal8Bit(logPath);
+
+  // Start a new log for every run, the header naming the columns
+  QFile log(_logPath);
+  if (log.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text)) {
+    QTextStream stream(&log);
+    stream << "turn,color,subsystem,allocations,bytes\n";
+  }
+
+  trackedThread = QThread::currentThreadId();
+}
+
+AllocationTracker::~AllocationTracker()
+{
+  trackedThread = 0;
+}
+
+AllocationSubsystems::eAllocationSubsystems AllocationTracker::enter(AllocationSubsystems::eAllocationSubsystems subsystem)
+{
+  AllocationSubsystems::eAllocationSubsystems previous = currentSubsystem;
+  if (QThread::currentThreadId() == trackedThread) {
+    currentSubsystem = subsystem;
+  }
+  return previous;
+}
+
+void AllocationTracker::leave(AllocationSubsystems::eAllocationSubsystems previous)
+{
+  if (QThread::currentThreadId() == trackedThread) {
+    currentSubsystem = previous;
+  }
+}
+
+void AllocationTracker::record(std::size_t bytes)
+{
+  if (trackedThread == 0) {
+    return;
+  }
+
+  // The subsystem entered is that of the tracked thread, so whatever the other threads allocate is counted apart
+  AllocationSubsystems::eAllocationSubsystems subsystem = AllocationSubsystems::eWorkerThreads;
+  if (QThread::currentThreadId() == trackedThread) {
+    if (suspended) {
+      return;
+    }
+    subsystem = currentSubsystem;
+  }
+
+  allocationCounts[subsystem].fetchAndAddRelaxed(1);
+  byteCounts[subsystem].fetchAndAddRelaxed(qint64(bytes));
+}
+
+void AllocationTracker::completeTurn(PieceColors::ePieceColors colorToMove)
+{
+  for (int subsystem = AllocationSubsystems::eInit; subsystem <= AllocationSubsystems::eMax; ++subsystem) {
+    _lastTurn[subsystem].allocations = allocationCounts[subsystem].fetchAndStoreRelaxed(0);
+    _lastTurn[subsystem].bytes = byteCounts[subsystem].fetchAndStoreRelaxed(0);
+  }
+
+  suspended = true;
+  writeLog();
+  suspended = false;
+
+  ++_turnNumber;
+  _turnColor = colorToMove;
+
+  emit turnCompleted();
+}
+
+AllocationTracker::Counts AllocationTracker::lastTurn(AllocationSubsystems::eAllocationSubsystems subsystem) const
+{
+  return _lastTurn[subsystem];
+}
+
+int AllocationTracker::lastTurnNumber() const
+{
+  return _turnNumber - 1;
+}
+
+QString AllocationTracker::subsystemName(AllocationSubsystems::eAllocationSubsystems subsystem)
+{
+  switch (subsystem) {
+  case AllocationSubsystems::eMoveGeneration     :
+    return QString("MoveGeneration");
+  case AllocationSubsystems::eLegalityValidation :
+    return QString("LegalityValidation");
+  case AllocationSubsystems::eRedraw             :
+    return QString("Redraw");
+  case AllocationSubsystems::eCapturedPieces     :
+    return QString("CapturedPieces");
+  case AllocationSubsystems::eWorkerThreads      :
+    return QString("WorkerThreads");
+  default                                        :
+    return QString("Other");
+  }
+}
+
+void AllocationTracker::writeLog() const
+{
+  QFile log(_logPath);
+  if (!log.open(QIODevice::Append | QIODevice::Text)) {
+    return;
+  }
+
+  QTextStream stream(&log);
+  QString color = PieceColors::getInstance().colorNames().at(_turnColor);
+
+  for (int subsystem = AllocationSubsystems::eInit; subsystem <= AllocationSubsystems::eMax; ++subsystem) {
+    stream << _turnNumber << ','
+           << color << ','
+           << subsystemName(AllocationSubsystems::eAllocationSubsystems(subsystem)) << ','
+           << _lastTurn[subsystem].allocations << ','
+           << _lastTurn[subsystem].bytes << '\n';
+  }
+}
+
+#ifdef CHESS_TRACK_ALLOCATIONS
+
+#if defined(__GLIBC__)
+
+// Executables take precedence over the shared libraries when symbols are resolved, so these stand in
+// for the malloc family of the C library, for Qt and for operator new alike.
+extern "C"
+{
+  void* __libc_malloc(std::size_t size);
+  void* __libc_calloc(std::size_t count, std::size_t size);
+  void* __libc_realloc(void* pointer, std::size_t size);
+
+  void* malloc(std::size_t size)
+  {
+    AllocationTracker::record(size);
+    return __libc_malloc(size);
+  }
+
+  void* calloc(std::size_t count, std::size_t size)
+  {
+    AllocationTracker::record(count * size);
+    return __libc_calloc(count, size);
+  }
+
+  void* realloc(void* pointer, std::size_t size)
+  {
+    AllocationTracker::record(size);
+    return __libc_realloc(pointer, size);
+  }
+}
+
+#else
+
+void* operator new(std::size_t size)
+{
+  AllocationTracker::record(size);
+
+  void* pointer = std::malloc(size ? size : 1);
+  if (pointer == 0) {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+void* operator new[](std::size_t size)
+{
+  return operator new(size);
+}
+
+void operator delete(void* pointer) throw()
+{
+  std::free(pointer);
+}
+
+void operator delete[](void* pointer) throw()
+{
+  std::free(pointer);
+}
+
+#endif // __GLIBC__
+
+#endif // CHESS_TRACK_ALLOCATIONS
@@ -0,0 +1,262 @@
+///
+/// \file   AllocationTracker.h
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This file contains structure definitions and members of the AllocationTracker class.
+///
+/// The tracker is only switched on in builds configured with "CONFIG+=allocation_tracking", which
+/// defines CHESS_TRACK_ALLOCATIONS.  In any other build TRACK_ALLOCATIONS expands to nothing.
+///
+
+#ifndef ALLOCATIONTRACKER_H
+#define ALLOCATIONTRACKER_H
+
+#include "Colors.h"
+
+#include <QObject>
+#include <QString>
+
+#include <cstddef>
+
+///
+/// The AllocationSubsystems struct houses an enumeration of the parts of the game allocations are counted for.
+///
+struct AllocationSubsystems {
+
+  ///
+  /// The eAllocationSubsystems enum houses the parts of the game allocations are counted for.
+  ///
+  enum eAllocationSubsystems {
+    eOther              = 0,               ///< enum value eOther counts whatever is allocated outside of the subsystems below.
+    eMoveGeneration,                       ///< enum value eMoveGeneration counts the mapping of the moves of a Player.
+    eLegalityValidation,                   ///< enum value eLegalityValidation counts the checking of moves and states for legality.
+    eRedraw,                               ///< enum value eRedraw counts the redrawing and highlighting of the squares of the Board.
+    eCapturedPieces,                       ///< enum value eCapturedPieces counts the repopulating of the captured pieces display.
+    eWorkerThreads,                        ///< enum value eWorkerThreads counts whatever the threads other than the GUI thread allocate, the AI search above all.
+    eInit               = eOther,          ///< enum value eInit is useful to always initialize elements to a valid state.
+    eMax                = eWorkerThreads   ///< enum value eMax implies it is the last subsystem in the range.
+  };
+};
+
+///
+/// The AllocationTracker class counts the allocations, and the bytes allocated, per subsystem per turn.
+///
+/// Every allocation made by the thread that created the tracker goes to the subsystem of the innermost
+/// AllocationScope alive at that time, or to eOther if there is none.  The allocations of every other
+/// thread, such as the one the AI searches on, go to eWorkerThreads.  The counters are atomic, so the
+/// threads may allocate at the same time.  When a turn begins, the counts of the turn that ended are
+/// appended to the log, kept for the debug overlay, and started over.
+///
+/// The log is a CSV file named by the CHESS_ALLOCATION_LOG environment variable, or allocations.csv in the
+/// working directory, with a line per turn per subsystem:
+/// \code
+///  turn,color,subsystem,allocations,bytes
+///  3,White,Redraw,1864,71520
+/// \endcode
+///
+/// With glibc the malloc family is interposed, so that the nodes Qt's containers get from malloc are
+/// counted along with whatever is allocated through operator new.  Elsewhere only operator new is counted.
+/// A realloc counts as an allocation of the new size.
+///
+class AllocationTracker : public QObject
+{
+  Q_OBJECT
+
+public:
+
+  ///
+  /// The Counts struct holds what a subsystem allocated during a turn.
+  ///
+  struct Counts {
+    qint64 allocations; ///< allocations is the number of allocations made.
+    qint64 bytes;       ///< bytes is the number of bytes asked for by those allocations.
+  };
+
+  ///
+  /// getInstance returns an instance reference, as the constructor is private.  Singleton Pattern.
+  ///
+  /// The first call decides which thread is counted by subsystem, and has to be made from the GUI thread.
+  ///
+  /// \return an instance reference to the static object of class AllocationTracker.
+  ///
+  static AllocationTracker& getInstance()
+  {
+    static AllocationTracker instance;
+    return instance;
+  }
+
+  ///
+  /// ~AllocationTracker is the default destructor for objects of type AllocationTracker.
+  ///
+  virtual ~AllocationTracker();
+
+  ///
+  /// enter makes the given subsystem the one allocations are counted for.
+  ///
+  /// Only the scopes of the thread counted by subsystem count, those of other threads change nothing.
+  ///
+  /// \param subsystem [in] is the subsystem to count allocations for.
+  /// \return the subsystem allocations were counted for up to now, to be handed to leave().
+  ///
+  static AllocationSubsystems::eAllocationSubsystems enter(AllocationSubsystems::eAllocationSubsystems subsystem);
+
+  ///
+  /// leave makes the subsystem returned by the matching enter() the one allocations are counted for again.
+  ///
+  /// \param previous [in] is the subsystem returned by the matching enter().
+  ///
+  static void leave(AllocationSubsystems::eAllocationSubsystems previous);
+
+  ///
+  /// record counts an allocation of the given size, for the subsystem entered if the thread counted by subsystem made it, or for eWorkerThreads if another thread did.
+  ///
+  /// It is called from within the allocator, and so allocates nothing itself.
+  ///
+  /// \param bytes [in] is the size of the allocation.
+  ///
+  static void record(std::size_t bytes);
+
+  ///
+  /// completeTurn logs the counts of the turn that ended, keeps them as the last turn's counts, and starts counting over.
+  ///
+  /// \param colorToMove [in] is the color of the Player whose turn begins.
+  ///
+  void completeTurn(PieceColors::ePieceColors colorToMove);
+
+  ///
+  /// lastTurn returns what a subsystem allocated during the last turn that ended.
+  ///
+  /// \param subsystem [in] is the subsystem to return the counts of.
+  /// \return the counts of the subsystem.
+  ///
+  Counts lastTurn(AllocationSubsystems::eAllocationSubsystems subsystem) const;
+
+  ///
+  /// lastTurnNumber returns the number of the last turn that ended, turn 0 being everything up to the first turn.
+  ///
+  /// \return the number of the turn.
+  ///
+  int lastTurnNumber() const;
+
+  ///
+  /// subsystemName returns the name a subsystem goes by in the log and the overlay.
+  ///
+  /// \param subsystem [in] is the subsystem to name.
+  /// \return the name of the subsystem.
+  ///
+  static QString subsystemName(AllocationSubsystems::eAllocationSubsystems subsystem);
+
+signals:
+
+  ///
+  /// turnCompleted is emitted once the counts of a turn have been logged, for the overlay to show them.
+  ///
+  void turnCompleted();
+
+private:
+
+  ///
+  /// AllocationTracker is the constructor for objects of the AllocationTracker class.
+  ///
+  /// \param parent is the QObject parent of the AllocationTracker instance.
+  ///
+  explicit AllocationTracker(QObject* parent = 0);
+
+  ///
+  /// AllocationTracker is the copy constructor for objects of the AllocationTracker class.  Private to enforce Singleton.
+  ///
+  AllocationTracker(const AllocationTracker&);
+
+  ///
+  /// operator = is the assignment operator for objects of the AllocationTracker class.  Private to enforce Singleton.
+  ///
+  void operator = (const AllocationTracker&);
+
+  ///
+  /// writeLog appends the counts of the turn that ended to the log.
+  ///
+  void writeLog() const;
+
+  ///
+  /// _lastTurn is the private member that holds the counts of the last turn that ended, per subsystem.
+  ///
+  Counts _lastTurn[AllocationSubsystems::eMax + 1];
+
+  ///
+  /// _turnNumber is the private member that holds the number of the turn being counted.
+  ///
+  int _turnNumber;
+
+  ///
+  /// _turnColor is the private member that holds the color of the Player whose turn is being counted.
+  ///
+  PieceColors::ePieceColors _turnColor;
+
+  ///
+  /// _logPath is the private member that holds the path of the log.
+  ///
+  QString _logPath;
+};
+
+///
+/// The AllocationScope class counts the allocations made during its lifetime for a subsystem.
+///
+/// Scopes nest, the innermost one alive decides the subsystem.  Use it through TRACK_ALLOCATIONS, e.g.
+/// \code
+///  void Board::clearHighLights()
+///  {
+///    TRACK_ALLOCATIONS(eRedraw);
+///    ...
+///  }
+/// \endcode
+///
+class AllocationScope
+{
+
+public:
+
+  ///
+  /// AllocationScope is the constructor for objects of the AllocationScope class.
+  ///
+  /// \param subsystem [in] is the subsystem to count the allocations for, until the scope ends.
+  ///
+  explicit AllocationScope(AllocationSubsystems::eAllocationSubsystems subsystem) :
+    _previous(AllocationTracker::enter(subsystem))
+  {
+
+  }
+
+  ///
+  /// ~AllocationScope goes back to counting allocations for the subsystem counted before the scope began.
+  ///
+  ~AllocationScope()
+  {
+    AllocationTracker::leave(_previous);
+  }
+
+private:
+
+  ///
+  /// AllocationScope is the copy constructor for objects of the AllocationScope class.  Private, as a scope cannot be shared.
+  ///
+  AllocationScope(const AllocationScope&);
+
+  ///
+  /// operator = is the assignment operator for objects of the AllocationScope class.  Private, as a scope cannot be shared.
+  ///
+  void operator = (const AllocationScope&);
+
+  ///
+  /// _previous is the private member that holds the subsystem counted before the scope began.
+  ///
+  AllocationSubsystems::eAllocationSubsystems _previous;
+};
+
+#ifdef CHESS_TRACK_ALLOCATIONS
+#define TRACK_ALLOCATIONS(subsystem) AllocationScope allocationScope(AllocationSubsystems::subsystem)
+#else
+#define TRACK_ALLOCATIONS(subsystem)
+#endif
+
+#endif // ALLOCATIONTRACKER_H
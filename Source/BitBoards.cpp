@@ -0,0 +1,152 @@
+///
+/// \file   BitBoards.cpp
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This file contains the construction of the precomputed BitBoards tables.
+///
+/// In this cpp file the tables are built by walking from every square in each of the
+/// eight compass directions, and along each of the eight knight jumps, once.  Everything else in BitBoards is a lookup.
+/// The Zobrist keys are drawn from a fixed seed, so a position hashes the same in every run.
+///
+
+#include "BitBoards.h"
+
+#include <cstring>
+
+namespace
+{
+  ///
+  /// rowSteps holds the row step of each of the eight compass directions, in Direction::eDirectionRules order.
+  ///
+  const int rowSteps[8]    = { -1, -1, 0, 1, 1,  1,  0, -1 };
+
+  ///
+  /// columnSteps holds the column step of each of the eight compass directions, in Direction::eDirectionRules order.
+  ///
+  const int columnSteps[8] = {  0,  1, 1, 1, 0, -1, -1, -1 };
+
+  ///
+  /// knightRowSteps and knightColumnSteps hold the eight jumps of a knight, pairwise.
+  ///
+  const int knightRowSteps[8]    = { -2, -2, -1, 1, 2,  2,  1, -1 };
+  const int knightColumnSteps[8] = { -1,  1,  2, 2, 1, -1, -2, -2 };
+
+  ///
+  /// stepTo gives the bit of the square a step away from a square, or an empty bit board if the step leaves the board.
+  ///
+  bitBoardType stepTo(squareType from, int rowStep, int columnStep)
+  {
+    boardCoordinateType cell = BitBoards::coordinate(from);
+    cell.first += rowStep;
+    cell.second += columnStep;
+
+    if (cell.first < 1 || cell.first > 8 || cell.second < 1 || cell.second > 8) {
+      return 0;
+    }
+    return BitBoards::squareBit(BitBoards::square(cell));
+  }
+
+  ///
+  /// ray collects every square from a square (exclusive) up to the edge of the board in one direction.
+  ///
+  bitBoardType ray(squareType from, int direction)
+  {
+    bitBoardType result = 0;
+    boardCoordinateType cell = BitBoards::coordinate(from);
+
+    for (;;) {
+      cell.first += rowSteps[direction];
+      cell.second += columnSteps[direction];
+      if (cell.first < 1 || cell.first > 8 || cell.second < 1 || cell.second > 8) {
+        break;
+      }
+      result |= BitBoards::squareBit(BitBoards::square(cell));
+    }
+    return result;
+  }
+
+  ///
+  /// nextRandom advances a xorshift generator and gives its next number.  A fixed seed keeps keys equal from run to run.
+  ///
+  hashType nextRandom(hashType& seed)
+  {
+    seed ^= seed >> 12;
+    seed ^= seed << 25;
+    seed ^= seed >> 27;
+    return seed * Q_UINT64_C(2685821657736338717);
+  }
+}
+
+BitBoards::BitBoards()
+{
+  std::memset(_between, 0, sizeof(_between));
+  std::memset(_line, 0, sizeof(_line));
+  std::memset(_pawnAttacks, 0, sizeof(_pawnAttacks));
+  std::memset(_zobrist, 0, sizeof(_zobrist));
+
+  hashType seed = Q_UINT64_C(1070372);
+  for (int color = PieceColors::eBlack; color <= PieceColors::eMax; ++color) {
+    for (int identity = Pieces::Identities::ePawn; identity <= Pieces::Identities::eMax; ++identity) {
+      for (squareType square = 0; square < 64; ++square) {
+        _zobrist[color][identity][square] = nextRandom(seed);
+      }
+    }
+  }
+
+  // No rights at all keeps the key of an empty GameState at 0
+  _zobristCastling[CastlingRights::eNone] = 0;
+  for (int rights = CastlingRights::eNone + 1; rights <= CastlingRights::eMax; ++rights) {
+    _zobristCastling[rights] = nextRandom(seed);
+  }
+
+  for (squareType square = 0; square < 64; ++square) {
+    _zobristEnPassant[square] = nextRandom(seed);
+  }
+
+  _zobristWhiteToMove = nextRandom(seed);
+
+  for (squareType from = 0; from < 64; ++from) {
+    _knightAttacks[from] = 0;
+    _kingAttacks[from] = 0;
+
+    for (int jump = 0; jump < 8; ++jump) {
+      _knightAttacks[from] |= stepTo(from, knightRowSteps[jump], knightColumnSteps[jump]);
+    }
+
+    // Black pawns move South (down the rows), white pawns move North
+    _pawnAttacks[PieceColors::eBlack][from] = stepTo(from, 1, -1) | stepTo(from, 1, 1);
+    _pawnAttacks[PieceColors::eWhite][from] = stepTo(from, -1, -1) | stepTo(from, -1, 1);
+
+    for (int direction = Direction::eInit; direction <= Direction::eMax; ++direction) {
+      _kingAttacks[from] |= stepTo(from, rowSteps[direction], columnSteps[direction]);
+      _rays[direction][from] = ray(from, direction);
+
+      // The opposite direction is always four steps further around the compass
+      bitBoardType fullLine = ray(from, direction) | ray(from, (direction + 4) % 8) | squareBit(from);
+
+      bitBoardType passed = 0;
+      boardCoordinateType cell = coordinate(from);
+
+      for (;;) {
+        cell.first += rowSteps[direction];
+        cell.second += columnSteps[direction];
+        if (cell.first < 1 || cell.first > 8 || cell.second < 1 || cell.second > 8) {
+          break;
+        }
+
+        squareType to = square(cell);
+        _between[from][to] = passed;
+        _line[from][to] = fullLine;
+        passed |= squareBit(to);
+      }
+    }
+  }
+}
+
+void BitBoards::toCoordinates(bitBoardType bitBoard, boardCoordinatesType& container)
+{
+  while (bitBoard) {
+    container.insert(coordinate(popLowestSquare(bitBoard)));
+  }
+}
@@ -0,0 +1,399 @@
+///
+/// \file   BitBoards.h
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This file contains structure definitions and members of the BitBoards struct.
+///
+
+#ifndef BITBOARDS_H
+#define BITBOARDS_H
+
+#include "CommonTypeDefinitions.h"
+#include "CastlingRights.h"
+#include "Direction.h"
+
+#include <QtAlgorithms>
+
+///
+/// The BitBoards struct houses precomputed square-set tables, along with helpers to convert between coordinates and squares.
+///
+/// A bit board represents a set of squares as a single 64-bit word.  Square 0 is coordinate (1,1) and
+/// square 63 is coordinate (8,8), counted row by row.  With the tables in place, questions like
+/// "is anything standing between these two cells?" or "are these three cells on one line?" become a
+/// single AND operation, without touching the GUI.  The same goes for the squares a piece attacks: the
+/// attacks of knights, kings and pawns are looked up, those of sliding pieces are a lookup per direction,
+/// cut short at the first piece in the way.
+///
+/// The tables are built once, the first time getInstance() is called.
+///
+struct BitBoards {
+
+public:
+
+  ///
+  /// getInstance returns an instance reference, as the constructor is private.  Singleton Pattern.
+  ///
+  /// \return an instance reference to the static object of struct BitBoards.
+  ///
+  static BitBoards& getInstance()
+  {
+    static BitBoards instance;
+    return instance;
+  }
+
+  ///
+  /// square converts a board coordinate to its square index.
+  ///
+  /// \param coordinate [in] a (row,column) coordinate, both ranging from 1 to 8.
+  /// \return the square index of the coordinate.
+  ///
+  static inline squareType square(const boardCoordinateType& coordinate)
+  {
+    return (coordinate.first - 1) * 8 + (coordinate.second - 1);
+  }
+
+  ///
+  /// coordinate converts a square index back to its board coordinate.
+  ///
+  /// \param square [in] the square index, ranging from 0 to 63.
+  /// \return the (row,column) coordinate of the square.
+  ///
+  static inline boardCoordinateType coordinate(squareType square)
+  {
+    return boardCoordinateType(square / 8 + 1, square % 8 + 1);
+  }
+
+  ///
+  /// squareBit gives the bit board that contains a single square.
+  ///
+  /// \param square [in] the square index.
+  /// \return a bit board with only the bit of square set.
+  ///
+  static inline bitBoardType squareBit(squareType square)
+  {
+    return bitBoardType(1) << square;
+  }
+
+  ///
+  /// lowestSquare gives the lowest square in a non-empty bit board.
+  ///
+  /// \param bitBoard [in] a bit board with at least one square set.
+  /// \return the index of the lowest square in bitBoard.
+  ///
+  static inline squareType lowestSquare(bitBoardType bitBoard)
+  {
+    return squareType(qCountTrailingZeroBits(bitBoard));
+  }
+
+  ///
+  /// highestSquare gives the highest square in a non-empty bit board.
+  ///
+  /// \param bitBoard [in] a bit board with at least one square set.
+  /// \return the index of the highest square in bitBoard.
+  ///
+  static inline squareType highestSquare(bitBoardType bitBoard)
+  {
+    return squareType(63 - qCountLeadingZeroBits(bitBoard));
+  }
+
+  ///
+  /// popLowestSquare removes the lowest square from a non-empty bit board and returns it.
+  ///
+  /// \param bitBoard [in,out] a bit board with at least one square set.
+  /// \return the index of the square that was removed.
+  ///
+  static inline squareType popLowestSquare(bitBoardType& bitBoard)
+  {
+    squareType square = lowestSquare(bitBoard);
+    bitBoard &= bitBoard - 1;
+    return square;
+  }
+
+  ///
+  /// count gives the number of squares in a bit board.
+  ///
+  /// \param bitBoard [in] the bit board to count.
+  /// \return the number of squares set.
+  ///
+  static inline int count(bitBoardType bitBoard)
+  {
+    return int(qPopulationCount(bitBoard));
+  }
+
+  ///
+  /// between gives the squares strictly between two squares that share a row, column or diagonal.
+  ///
+  /// \param squareA [in] the first square.
+  /// \param squareB [in] the second square.
+  /// \return the squares in between, or an empty bit board if the squares are not aligned or adjacent.
+  ///
+  inline bitBoardType between(squareType squareA, squareType squareB) const
+  {
+    return _between[squareA][squareB];
+  }
+
+  ///
+  /// line gives the full row, column or diagonal through two squares, from one edge of the board to the other.
+  ///
+  /// \param squareA [in] the first square.
+  /// \param squareB [in] the second square.
+  /// \return the squares on the line, including squareA and squareB, or an empty bit board if they are not aligned.
+  ///
+  inline bitBoardType line(squareType squareA, squareType squareB) const
+  {
+    return _line[squareA][squareB];
+  }
+
+  ///
+  /// isAligned determines whether three squares lie on the same row, column or diagonal.
+  ///
+  /// This is the question asked for pins: a piece on squareC is pinned by an attacker on squareB
+  /// against a king on squareA, only if it is aligned with both, and alone between them.
+  ///
+  /// \param squareA [in] the first square.
+  /// \param squareB [in] the second square.
+  /// \param squareC [in] the square to test against the line through squareA and squareB.
+  /// \return true if all three squares are on one line.
+  ///
+  inline bool isAligned(squareType squareA, squareType squareB, squareType squareC) const
+  {
+    return (_line[squareA][squareB] & squareBit(squareC)) != 0;
+  }
+
+  ///
+  /// promotionRow gives the row a pawn of a colour promotes on.  Black pawns promote on row 8, white pawns on row 1.
+  ///
+  /// \param color [in] the colour of the pawn.
+  /// \return the squares of the promotion row.
+  ///
+  static inline bitBoardType promotionRow(PieceColors::ePieceColors color)
+  {
+    return color == PieceColors::eBlack ? Q_UINT64_C(0xFF00000000000000) : Q_UINT64_C(0x00000000000000FF);
+  }
+
+  ///
+  /// knightAttacks gives the squares a knight attacks from a square.
+  ///
+  /// \param square [in] the square the knight stands on.
+  /// \return the attacked squares.
+  ///
+  inline bitBoardType knightAttacks(squareType square) const
+  {
+    return _knightAttacks[square];
+  }
+
+  ///
+  /// kingAttacks gives the squares a king attacks from a square.
+  ///
+  /// \param square [in] the square the king stands on.
+  /// \return the attacked squares.
+  ///
+  inline bitBoardType kingAttacks(squareType square) const
+  {
+    return _kingAttacks[square];
+  }
+
+  ///
+  /// pawnAttacks gives the squares a pawn attacks from a square.  Black pawns attack South, white pawns attack North.
+  ///
+  /// \param color [in] the colour of the pawn.
+  /// \param square [in] the square the pawn stands on.
+  /// \return the attacked squares.
+  ///
+  inline bitBoardType pawnAttacks(PieceColors::ePieceColors color, squareType square) const
+  {
+    return _pawnAttacks[color][square];
+  }
+
+  ///
+  /// bishopAttacks gives the squares a bishop attacks from a square, up to and including the first piece in each direction.
+  ///
+  /// \param square [in] the square the bishop stands on.
+  /// \param occupied [in] the occupied squares of the board.
+  /// \return the attacked squares.
+  ///
+  inline bitBoardType bishopAttacks(squareType square, bitBoardType occupied) const
+  {
+    return rayAttacks(Direction::eMayMoveNorthEast, square, occupied) |
+           rayAttacks(Direction::eMayMoveSouthEast, square, occupied) |
+           rayAttacks(Direction::eMayMoveSouthWest, square, occupied) |
+           rayAttacks(Direction::eMayMoveNorthWest, square, occupied);
+  }
+
+  ///
+  /// castleAttacks gives the squares a castle attacks from a square, up to and including the first piece in each direction.
+  ///
+  /// \param square [in] the square the castle stands on.
+  /// \param occupied [in] the occupied squares of the board.
+  /// \return the attacked squares.
+  ///
+  inline bitBoardType castleAttacks(squareType square, bitBoardType occupied) const
+  {
+    return rayAttacks(Direction::eMayMoveNorth, square, occupied) |
+           rayAttacks(Direction::eMayMoveEast,  square, occupied) |
+           rayAttacks(Direction::eMayMoveSouth, square, occupied) |
+           rayAttacks(Direction::eMayMoveWest,  square, occupied);
+  }
+
+  ///
+  /// queenAttacks gives the squares a queen attacks from a square, up to and including the first piece in each direction.
+  ///
+  /// \param square [in] the square the queen stands on.
+  /// \param occupied [in] the occupied squares of the board.
+  /// \return the attacked squares.
+  ///
+  inline bitBoardType queenAttacks(squareType square, bitBoardType occupied) const
+  {
+    return bishopAttacks(square, occupied) | castleAttacks(square, occupied);
+  }
+
+  ///
+  /// zobrist gives the random key of a piece on a square.  The key of a board state is the exclusive or of the keys of all its pieces.
+  ///
+  /// \param color [in] the colour of the piece.
+  /// \param identity [in] the identity of the piece.
+  /// \param square [in] the square the piece stands on.
+  /// \return the key, 0 for an empty square.
+  ///
+  inline hashType zobrist(PieceColors::ePieceColors color, Pieces::Identities::eIdentities identity, squareType square) const
+  {
+    return _zobrist[color][identity][square];
+  }
+
+  ///
+  /// zobristCastling gives the random key of a combination of castling rights.
+  ///
+  /// \param rights [in] the combination of CastlingRights::eCastlingRights flags.
+  /// \return the key, 0 if nobody may castle.
+  ///
+  inline hashType zobristCastling(int rights) const
+  {
+    return _zobristCastling[rights];
+  }
+
+  ///
+  /// zobristEnPassant gives the random key of the square a pawn may be captured en passant on.
+  ///
+  /// \param square [in] the square the capturing pawn would move to.
+  /// \return the key.
+  ///
+  inline hashType zobristEnPassant(squareType square) const
+  {
+    return _zobristEnPassant[square];
+  }
+
+  ///
+  /// zobristWhiteToMove gives the random key of white being the side to move.
+  ///
+  /// A GameState does not know whose turn it is, so its hash() leaves the side to move out.  Whoever keeps
+  /// positions of both sides in one table, such as a search, folds this key in when white is to move.
+  ///
+  /// \return the key.
+  ///
+  inline hashType zobristWhiteToMove() const
+  {
+    return _zobristWhiteToMove;
+  }
+
+  ///
+  /// toCoordinates converts a bit board into the coordinate set used by the rest of the Board.
+  ///
+  /// \param bitBoard [in] the bit board to convert.
+  /// \param container [in,out] the set the coordinates are added to.
+  ///
+  static void toCoordinates(bitBoardType bitBoard, boardCoordinatesType& container);
+
+private:
+
+  ///
+  /// BitBoards is the private default constructor for objects of BitBoards, it builds the tables.
+  ///
+  BitBoards();
+
+  ///
+  /// BitBoards declared as private, this copy- by-const-reference constructor is now no longer accessible.
+  ///
+  BitBoards(BitBoards const&);
+
+  ///
+  /// operator = declared as private, this copy- by-const-reference operator is now no longer accessible.
+  ///
+  void operator=(BitBoards const&);
+
+  ///
+  /// rayAttacks gives the squares attacked along a single direction, up to and including the first piece.
+  ///
+  /// Directions that count squares upwards (East, South-East, South, South-West) are cut off at their lowest
+  /// blocker, the others at their highest blocker.  Whatever lies beyond the blocker is the blocker's own ray.
+  ///
+  /// \param direction [in] the direction to look in.
+  /// \param square [in] the square to look from.
+  /// \param occupied [in] the occupied squares of the board.
+  /// \return the attacked squares.
+  ///
+  inline bitBoardType rayAttacks(Direction::eDirectionRules direction, squareType square, bitBoardType occupied) const
+  {
+    bitBoardType attacks = _rays[direction][square];
+    bitBoardType blockers = attacks & occupied;
+
+    if (blockers) {
+      bool upwards = direction >= Direction::eMayMoveEast && direction <= Direction::eMayMoveSouthWest;
+      squareType blocker = upwards ? lowestSquare(blockers) : highestSquare(blockers);
+      attacks &= ~_rays[direction][blocker];
+    }
+    return attacks;
+  }
+
+  ///
+  /// _rays is the private member that stores, per direction, every square from a square up to the edge of the board.
+  ///
+  bitBoardType _rays[Direction::eMax + 1][64];
+
+  ///
+  /// _knightAttacks is the private member that stores the squares a knight attacks from each square.
+  ///
+  bitBoardType _knightAttacks[64];
+
+  ///
+  /// _kingAttacks is the private member that stores the squares a king attacks from each square.
+  ///
+  bitBoardType _kingAttacks[64];
+
+  ///
+  /// _pawnAttacks is the private member that stores the squares a pawn of each colour attacks from each square.
+  ///
+  bitBoardType _pawnAttacks[PieceColors::eMax + 1][64];
+
+  ///
+  /// _between is the private member that stores the squares strictly between every pair of squares.
+  ///
+  bitBoardType _between[64][64];
+
+  ///
+  /// _line is the private member that stores the full line through every pair of aligned squares.
+  ///
+  bitBoardType _line[64][64];
+
+  ///
+  /// _zobrist is the private member that stores the random key of each colour and identity on each square.
+  ///
+  hashType _zobrist[PieceColors::eMax + 1][Pieces::Identities::eMax + 1][64];
+
+  ///
+  /// _zobristCastling is the private member that stores the random key of each combination of castling rights.
+  ///
+  hashType _zobristCastling[CastlingRights::eMax + 1];
+
+  ///
+  /// _zobristEnPassant is the private member that stores the random key of each en passant square.
+  ///
+  hashType _zobristEnPassant[64];
+
+  ///
+  /// _zobristWhiteToMove is the private member that stores the random key of white being the side to move.
+  ///
+  hashType _zobristWhiteToMove;
+};
+
+#endif // BITBOARDS_H
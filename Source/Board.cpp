@@ -7,7 +7,7 @@
 /// In this cpp file is housed all the functions and attributes needed to construct and manage a
 /// a chess board in three different stages of play; backed up, current, and proposed states.
 ///
-/// It is made up of Cells that contain pieces, and these are mapped by (x,y) (row,column)
+/// It is drawn by a single BoardView, and its squares (cells) are mapped by (x,y) (row,column)
 /// coordinate sets.
 ///
 /// The states that are used to keep track of how the game is played are static.
@@ -28,10 +28,15 @@
 #include "Board.h"
 #include "ui_Board.h"
 
-#include "Piece.h"
+#include "BoardView.h"
 #include "TurnManager.h"
+#include "MoveMapper.h"
+#include "BitBoards.h"
+#include "AllocationTracker.h"
+#include "TurnTracer.h"
 
 #include <QDebug>
+#include <QInputDialog>
 #include <QMessageBox>
 
 boardStateMapType Board::_workingBoardStateMap  = boardStateMapType();
@@ -42,9 +47,12 @@ piecesListType Board::_workingCapturedPieces  = piecesListType();
 piecesListType Board::_backedUpCapturedPieces = piecesListType();
 piecesListType Board::_stagingCapturedPieces  = piecesListType();
 
+GameHistory Board::_gameHistory = GameHistory();
+
 Board::Board(QWidget* parent):
   QWidget(parent),
-  ui(new Ui::Board)
+  ui(new Ui::Board),
+  _promotion(Pieces::Identities::eNone)
 {
   ui->setupUi(this);
   resetBoard(true, true);
@@ -55,237 +63,102 @@ Board::~Board()
 
 }
 
-void Board::updatePieceMap(Cell* from, Cell* to, boardStateMapType& boardStateMap, piecesListType& capturedPiecesContainer)
+void Board::updatePieceMap(boardCoordinateType fromCoords,
+                           boardCoordinateType toCoords,
+                           boardStateMapType& boardStateMap,
+                           piecesListType& capturedPiecesContainer,
+                           Pieces::Identities::eIdentities promotion)
 {
-  boardCoordinateType fromCoords = boardCoordinateType(from->row(), from->column());
-  definedPieceType fromType = definedPieceType(from->assignedPiece()->identity(), from->assignedPiece()->color());
-
-  boardCoordinateType toCoords = boardCoordinateType(to->row(), to->column());
-  definedPieceType toType = definedPieceType(to->assignedPiece()->identity(), to->assignedPiece()->color());
-
-  // check if this is an attack
-  if (toType.first != Pieces::Identities::eNone) {
-    // It's an attack
-    // Destination piece is now considered to be captured
-    capturedPiecesContainer.append(toType);
-    boardStateMap.remove(toCoords);
-  }
-
   Q_ASSERT_X(boardStateMap.contains(fromCoords), "updatePieceMap", "From-position not found in map!");
 
-  boardStateMap.take(fromCoords); // takes the piece from its old location
-  boardStateMap.insert(toCoords, fromType); // puts it in its new location
+  // Castling, en passant and promotion are all taken care of by the state itself
+  definedPieceType captured = boardStateMap.makeMove(BitBoards::square(fromCoords), BitBoards::square(toCoords), promotion);
+
+  // check if this was an attack
+  if (captured.first != Pieces::Identities::eNone) {
+    // Captured piece is now considered to be captured
+    capturedPiecesContainer.append(captured);
+  }
 }
 
 void Board::clearHighLights()
 {
-  for (int row = 1; row <= 8; ++row)
-    for (int column = 1; column <= 8; ++column) {
-
-      Cell* cell = getCell(row, column);
+  TRACK_ALLOCATIONS(eRedraw);
 
-      if (cell != NULL) {
-
-        cell->toggleCellHighlights(false);
-      }
-    }
+  ui->_boardView->clearHighlights();
 }
 
 void Board::moveInitiated(boardCoordinateType fromWhere)
 {
-  boardCoordinateType locationOfAttacker;
-  boardCoordinateType locationOfVictim;
-  definedPieceType    pieceWhoWillBeAttacking;
-  definedPieceType    pieceWhoWillBeAttacked;
+  TRACE_SCOPE("Board::moveInitiated");
 
   // validate that there is actually a piece there on the board.
-  if (getCell(fromWhere)->assignedPiece()->identity() == Pieces::Identities::eNone ||
-      getCell(fromWhere)->assignedPiece()->color() == PieceColors::eNone) {
-    getCell(fromWhere)->setChecked(false);
-    getCell(fromWhere)->toggleCellHighlights(false);
+  if (_workingBoardStateMap.value(fromWhere).first == Pieces::Identities::eNone ||
+      _workingBoardStateMap.value(fromWhere).second == PieceColors::eNone) {
+    ui->_boardView->clearSelection();
+    ui->_boardView->setHighlighted(fromWhere, false);
     return;
   }
 
   boardCoordinatesType containerForHighlighting = boardCoordinatesType();
 
   // If we reach this point, it is a real piece, and it is the right color for the user trying to move it.
-  // Let's evaluate the current boardState
-
-  bool boardIsValid = evaluateBoardState(_workingBoardStateMap);
-
-  // This would imply the King of the current Player is checked, so valid moves
-  if (!boardIsValid) {
-    // see if any potential moves can bring the board into a legal state (uncheck the king)
-    // first check if the selected cell can attack the offender
-
-    movementType rules = MoveRules::getMovementRules(getCell(fromWhere)->assignedPiece()->identity(), getCell(fromWhere)->assignedPiece()->color());
-    definedPieceType currentPiece = definedPieceType(getCell(fromWhere)->assignedPiece()->identity(), getCell(fromWhere)->assignedPiece()->color());
-    boardCoordinatesType container = boardCoordinatesType();
-
-    // Map it's possible moves.  mapMoves() only returns "legal" moves
-    mapMoves(rules, currentPiece, container, fromWhere, _workingBoardStateMap);
-
-    if (getCell(fromWhere)->assignedPiece()->identity() == Pieces::Identities::eKing) {
-      if (!container.isEmpty()) {
-        boardCoordinatesType set;
-        bool canItBeAttacked = isTheTargetWithinRange(_pieceWhoWillBeAttacking.second,
-                                                      _pieceWhoWillBeAttacking.first,
-                                                      set,
-                                                      _workingBoardStateMap,
-                                                      locationOfAttacker,
-                                                      locationOfVictim,
-                                                      pieceWhoWillBeAttacking,
-                                                      pieceWhoWillBeAttacked);
-        if (canItBeAttacked) {
-          // Attack it
-          _locationStart = locationOfAttacker;
-          containerForHighlighting = set;
-        }
-        else {
-          // Run away
-          boardCoordinatesType set = getPath(_locationOfVictim, _locationOfAttacker, _workingBoardStateMap);
-          bool pathCanBePotentiallyAvoided = !set.isEmpty();
-          if (pathCanBePotentiallyAvoided) {
-            boardCoordinatesType possibleMoves = container.subtract(set);
-            if (!possibleMoves.isEmpty()) {
-              // record the starting-cell, highlight the outcomes
-              _locationStart = fromWhere;
-              containerForHighlighting = possibleMoves;
-            }
-            else {
-              // Selected piece has no available moves.
-            }
-          }
-        }
-      }
-    }
-    else if (getCell(fromWhere)->assignedPiece()->identity() == Pieces::Identities::eKnight) {
-      // Knight's path is L-shaped, not straight horizontal/vertical/diagonal like the other pieces
-      // It is a piece, it is the right color.  Map it's move-rules
-
-      if (!container.isEmpty()) {
-        boardCoordinatesType set;
-        bool canItBeAttacked = isTheTargetWithinRange(_pieceWhoWillBeAttacking.second,
-                                                      _pieceWhoWillBeAttacking.first,
-                                                      set,
-                                                      _workingBoardStateMap,
-                                                      locationOfAttacker,
-                                                      locationOfVictim,
-                                                      pieceWhoWillBeAttacking,
-                                                      pieceWhoWillBeAttacked);
-        if (canItBeAttacked) {
-          // Attack it
-          _locationStart = locationOfAttacker;
-          containerForHighlighting = set;
-        }
-        else {
-          // Try to block its path
-          boardCoordinatesType set = getPath(_locationOfVictim, _locationOfAttacker, _workingBoardStateMap);
-          bool pathCanBePotentiallyBlocked = !set.isEmpty();
-          if (pathCanBePotentiallyBlocked) {
-            boardCoordinatesType possibleMoves = set.intersect(container);
-            if (!possibleMoves.isEmpty()) {
-              // record the starting-cell, highlight the outcomes
-              _locationStart = fromWhere;
-              containerForHighlighting = possibleMoves;
-            }
-            else {
-              // Selected piece has no available moves.
-            }
-          }
-        }
-      }
-    }
-    else {
-      boardCoordinatesType set = getPath(fromWhere, _locationOfAttacker, _workingBoardStateMap);
-
-      bool canItBeAttacked = !set.isEmpty();
-      // If we can attack it directly, there will be a path to it.
-      if (canItBeAttacked) {
-        // Attack it
-        _locationStart = fromWhere;
-        containerForHighlighting = set;
-      }
-      else { // can we block its path?
-        set = getPath(_locationOfVictim, _locationOfAttacker, _workingBoardStateMap);
-        bool pathCanBePotentiallyBlocked = !set.isEmpty();
-        if (pathCanBePotentiallyBlocked) {
-          boardCoordinatesType possibleMoves = set.intersect(container);
-          if (!possibleMoves.isEmpty()) {
-            // record the starting-cell, highlight the outcomes
-            _locationStart = fromWhere;
-            containerForHighlighting = possibleMoves;
-          }
-          else {
-            // Selected piece has no available moves.
-          }
-        }
-      }
-    }
-  }
-  else {
-    // Board is in a valid state (your king is not in danger)
-    movementType rules = MoveRules::getMovementRules(getCell(fromWhere)->assignedPiece()->identity(), getCell(fromWhere)->assignedPiece()->color());
-    definedPieceType currentPiece = definedPieceType(getCell(fromWhere)->assignedPiece()->identity(), getCell(fromWhere)->assignedPiece()->color());
-    boardCoordinatesType container = boardCoordinatesType();
-
-    // Map it's possible moves.  mapMoves() only returns "legal" moves
-    mapMoves(rules, currentPiece, container, fromWhere, _workingBoardStateMap);
-
-
-    if (!container.isEmpty()) {
-      // One last check to see if any of the proposed moves will in fact result in an invalid board state.
-      boardCoordinatesType::iterator containerIterator = container.begin();
-      while (containerIterator != container.end()) {
-        boardStateMapType tempState = _workingBoardStateMap;
-        piecesListType tempPieces = _workingCapturedPieces;
-        boardCoordinateType toWhere = *containerIterator;
-        Cell* from = getCell(fromWhere);
-        Cell* to = getCell(toWhere);
-        movePieceStart(this, from, to, tempState, tempPieces);
-
-        bool boardStillValid = evaluateBoardState(tempState);
-        if (!boardStillValid) { // this will check the current Player's king
-          container.remove(toWhere);
-          containerIterator = container.begin();
-        }
-        else {
-          ++containerIterator;
-        }
-        movePieceRevertMove(tempState, tempPieces);
-      }
+  // The legal moves of the current Player were generated when the turn started (checks and pins included),
+  // so all that is left is to look up those of this piece.
+  PieceColors::ePieceColors playerColor = TurnManager::currentPlayer()->associatedColor();
+  const LegalMoveTable& legalMoves = MoveMapper::getInstance().legalMoves(_workingBoardStateMap, playerColor);
+  bitBoardType legalTargets = legalMoves.destinations[BitBoards::square(fromWhere)];
+  BitBoards::toCoordinates(legalTargets, containerForHighlighting);
 
-      if (!container.isEmpty()) {
-        _locationStart = fromWhere;
-        containerForHighlighting = container;
-      }
-    }
+  if (!containerForHighlighting.isEmpty()) {
+    // record the starting-cell, highlight the outcomes
+    _locationStart = fromWhere;
   }
 
   if (containerForHighlighting.isEmpty()) {
     clearHighLights();
-    uncheckAllCheckedCells();
+    clearSelection();
     return;
   }
   else {
     highLightCoordinates(containerForHighlighting);
+    ui->_boardView->setLegalTargets(legalTargets);
     _containerForMoving = containerForHighlighting;
   }
-
-  emit moveInitiatedComplete(TurnManager::getInstance().currentPlayer());
 }
 
 void Board::continueInitiatedMove(boardCoordinateType whereTo)
 {
+  TRACE_SCOPE("Board::continueInitiatedMove");
+
   _locationEnd = whereTo;
 
   // check if the move will be allowed
   if (_containerForMoving.contains(whereTo)) {
-    Cell* whereFrom = getCell(_locationStart);
-    Cell* whereTo =   getCell(_locationEnd);
-    movePieceStart(this, whereFrom, whereTo);
-    movePieceCompleteMove(this);
+    // A pawn clicked onto the last row becomes the piece the Player picks, cancelling calls the move off
+    definedPieceType moving = _workingBoardStateMap.value(_locationStart);
+    if (_promotion == Pieces::Identities::eNone && moving.first == Pieces::Identities::ePawn &&
+        (BitBoards::promotionRow(moving.second) & BitBoards::squareBit(BitBoards::square(_locationEnd))) != 0) {
+      _promotion = askForPromotion();
+      if (_promotion == Pieces::Identities::eNone) {
+        clearHighLights();
+        clearSelection();
+        return;
+      }
+    }
+
+    // Captures and Pawn moves can never be undone, so no earlier position can come back after them
+    bool irreversible = _workingBoardStateMap.value(_locationStart).first == Pieces::Identities::ePawn ||
+                        _workingBoardStateMap.contains(_locationEnd);
 
+    // A piece picked for a premove while the AI was thinking is picked again once the move is shown
+    boardCoordinateType pendingSelection = ui->_boardView->selection();
+
+    movePieceStart(_locationStart, _locationEnd, _workingBoardStateMap, _workingCapturedPieces, _promotion);
+    _promotion = Pieces::Identities::eNone;
+    _gameHistory.push(_workingBoardStateMap.hash(), irreversible);
+    movePieceCompleteMove(this);
+    ui->_boardView->slidePiece(_locationStart, _locationEnd);
 
     if (TurnManager::getInstance().currentPlayer()->identity() == UserIdentity::eHuman) {
       TurnManager::switchPlayers(_aiPlayer);
@@ -295,31 +168,93 @@ void Board::continueInitiatedMove(boardCoordinateType whereTo)
     }
 
     if (TurnManager::getInstance().currentPlayer()->identity() == UserIdentity::eHuman) {
-      bool boardIsValid = evaluateBoardState(_workingBoardStateMap);
-      if (!boardIsValid) {
-        QMessageBox::information(0, QString("Check!"), QString("Your King is Checked!"), QMessageBox::Ok);
+      // The AI has replied, so the first premove queued is played right away, if it is still legal
+      bool premovePlayed = playPremove();
+
+      if (pendingSelection != boardCoordinateType(0, 0) && isEnabled()) {
+        ui->_boardView->clickSquare(pendingSelection);
+      }
+
+      if (!premovePlayed) {
+        bool boardIsValid = evaluateBoardState(_workingBoardStateMap, _humanPlayer->associatedColor());
+        if (!boardIsValid) {
+          QMessageBox::information(0, QString("Check!"), QString("Your King is Checked!"), QMessageBox::Ok);
+        }
       }
     }
 
   }
   else {
     clearHighLights();
-    uncheckAllCheckedCells();
+    clearSelection();
   }
 }
 
-void Board::handleMoveInitiatedComplete(QSharedPointer<Player>& playerWhoInitiated)
+bool Board::playMove(const boardMoveType& move)
 {
-  if (playerWhoInitiated->identity() == aiPlayer()->identity()) {
-    startTimer(400);
+  TRACE_SCOPE("Board::playMove");
+
+  PieceColors::ePieceColors playerColor = TurnManager::currentPlayer()->associatedColor();
+  if (!MoveMapper::getInstance().isLegalMove(move, _workingBoardStateMap, playerColor)) {
+    return false;
   }
+
+  _locationStart = move.first;
+  _promotion = move.promotion == Pieces::Identities::eNone ? Pieces::Identities::eQueen : move.promotion;
+  _containerForMoving.clear();
+  _containerForMoving.insert(move.second);
+  continueInitiatedMove(move.second);
+  return true;
+}
+
+void Board::queuePremove(boardMoveType premove)
+{
+  clearHighLights();
+  _premoves.append(premove);
+  ui->_boardView->setPremoves(_premoves);
+}
+
+void Board::cancelPremoves()
+{
+  _premoves.clear();
+  ui->_boardView->setPremoves(_premoves);
 }
 
-void Board::timerEvent(QTimerEvent* event)
+Pieces::Identities::eIdentities Board::askForPromotion()
 {
-  // Immediately kill the timer, as only one action by the AI is required.
-  killTimer(event->timerId());
-  emit aiMoveCompletionRequired();
+  QStringList names = Pieces::getInstance().identityNames();
+  QList<Pieces::Identities::eIdentities> choices;
+  choices << Pieces::Identities::eQueen << Pieces::Identities::eCastle
+          << Pieces::Identities::eBishop << Pieces::Identities::eKnight;
+
+  QStringList items;
+  for (int index = 0; index < choices.size(); ++index) {
+    items << names.at(choices.at(index));
+  }
+
+  bool picked = false;
+  QString item = QInputDialog::getItem(this, QString("Promotion"), QString("Promote the Pawn to:"), items, 0, false, &picked);
+  if (!picked) {
+    return Pieces::Identities::eNone;
+  }
+  return choices.at(items.indexOf(item));
+}
+
+bool Board::playPremove()
+{
+  if (_premoves.isEmpty()) {
+    return false;
+  }
+
+  boardMoveType premove = _premoves.takeFirst();
+  ui->_boardView->setPremoves(_premoves);
+
+  // A premove the reply of the AI made illegal, or the game ended before, calls off those queued after it too
+  if (!isEnabled() || !playMove(premove)) {
+    cancelPremoves();
+    return false;
+  }
+  return true;
 }
 
 definedPieceType Board::pieceWhoWillBeAttacked() const
@@ -382,330 +317,46 @@ void Board::setHumanPlayer(const QSharedPointer<Player>& humanPlayer)
   _humanPlayer = humanPlayer;
 }
 
-boardCoordinateType Board::findPiece(PieceColors::ePieceColors colorThatIsToBeFound,
-                                     Pieces::Identities::eIdentities identityThatIsToBeFound,
-                                     boardStateMapType& boardStateToUse)
-{
-  definedPieceType pieceType = definedPieceType(identityThatIsToBeFound, colorThatIsToBeFound);
-  return findPiece(pieceType, boardStateToUse);
-}
-
-boardCoordinateType Board::findPiece(definedPieceType piece, boardStateMapType& boardStateToUse)
-{
-  boardCoordinateType pieceLocation = boardCoordinateType(0, 0);
-  bool foundIt = false;
-  // Iterate through the current board map to see if any enemy piece can reach the piece
-  // described by color and identity
-  for (int row = eMinRow; row <= eMaxRow; ++row) {
-    if (foundIt) {
-      break;
-    }
-
-    for (int column = eMinColumn; column <= eMaxColumn; ++column) {
-      boardCoordinateType currentCoordinate = boardCoordinateType(row, column);
-      definedPieceType currentPiece = boardStateToUse.value(currentCoordinate);
-
-      Pieces::Identities::eIdentities currentPieceIdentity = currentPiece.first;
-      PieceColors::ePieceColors currentPieceColor = currentPiece.second;
-
-      if (currentPieceIdentity == Pieces::Identities::eNone) {
-        // No piece on this cell
-        continue;
-      }
-      if (currentPieceColor != piece.second) {
-        // Wrong color for piece
-        continue;
-      }
-      if (currentPieceIdentity != piece.first) {
-        // Right color, not an empty cell, wrong identity
-        continue;
-      }
-
-      // Reaching this point we now have the location of the piece.
-      pieceLocation = currentCoordinate;
-      foundIt = true;
-      break;
-    }
-  }
-  return pieceLocation;
-}
-
-boardCoordinatesType Board::findPieces(definedPieceType piece, boardStateMapType& boardStateToSearch)
-{
-  boardCoordinatesType retVal;
-  if (piece.first == Pieces::Identities::eKing ||
-      piece.first == Pieces::Identities::eQueen) { // Only one of each
-    boardCoordinateType partOfRetVal = findPiece(piece, boardStateToSearch);
-    retVal.insert(partOfRetVal);
-    return retVal;
-  }
-
-  boardCoordinateType pieceLocation = boardCoordinateType(0, 0);
-
-  // Iterate through the current board map to see if any enemy piece can reach the piece
-  // described by color and identity
-  for (int row = eMinRow; row <= eMaxRow; ++row) {
-    for (int column = eMinColumn; column <= eMaxColumn; ++column) {
-      boardCoordinateType currentCoordinate = boardCoordinateType(row, column);
-      definedPieceType currentPiece = _workingBoardStateMap.value(currentCoordinate);
-
-      Pieces::Identities::eIdentities currentPieceIdentity = currentPiece.first;
-      PieceColors::ePieceColors currentPieceColor = currentPiece.second;
-
-      if (currentPieceIdentity == Pieces::Identities::eNone) {
-        // No piece on this cell
-        continue;
-      }
-      if (currentPieceColor != piece.second) {
-        // Wrong color for piece
-        continue;
-      }
-      if (currentPieceIdentity != piece.first) {
-        // Right color, not an empty cell, wrong identity
-        continue;
-      }
-
-      // Reaching this point we now have the location of the piece.
-      pieceLocation = currentCoordinate;
-      retVal.insert(pieceLocation);
-    }
-  }
-  return retVal;
-}
-
 void Board::highLightCoordinates(boardCoordinatesType& set)
 {
+  TRACK_ALLOCATIONS(eRedraw);
+
   boardCoordinatesType::iterator i = set.begin();
 
   while (i != set.end()) {
     boardCoordinateType coordinate = *i;
     ++i;
 
-    Cell* toCell = getCell(coordinate.first, coordinate.second);
-
-    toCell->toggleCellHighlights(true);
+    ui->_boardView->setHighlighted(coordinate, true);
   }
 }
 
-void Board::toggleCell(Cell* cell)
+bool Board::evaluateBoardState(boardStateMapType& boardStateToEvaluate, PieceColors::ePieceColors colorToEvaluate)
 {
-  cell->toggle();
-}
+  TRACK_ALLOCATIONS(eLegalityValidation);
 
-boardCoordinatesType Board::getPath(boardCoordinateType pointA, boardCoordinateType pointB, boardStateMapType& boardStateToSearch)
-{
-  boardCoordinatesType returnSet;
-  int rowA = pointA.first;
-  int columnA = pointA.second;
-
-  int rowB = pointB.first;
-  int columnB = pointB.second;
-
-  int rowMax = rowA > rowB ? rowA : rowB;
-  int columnMax = columnA > columnB ? columnA : columnB;
-  int rowMin = rowA < rowB ? rowA : rowB;
-  int columnMin = columnA < columnB ? columnA : columnB;
-
-  int stepFactorRows = (rowA < rowB) ? 1 : -1;
-  int stepFactorColumns = (columnA < columnB) ? 1 : -1;
-  int newColumn = columnA;
-
-  // Make a few practical decisions.
-  if (rowMin == rowMax) { // The piece moves horizontally as the row value doesn't change
-    if (getCell(pointA)->assignedPiece()->identity() == Pieces::Identities::ePawn) {
-      return returnSet;
-    }
-    // Only need to iterate through the x-axis
-    for (int i = columnA + stepFactorColumns; i != columnB + stepFactorColumns; i += stepFactorColumns) {
-      boardCoordinateType temp = boardCoordinateType(rowMax, i);
-      if (boardStateToSearch.value(temp).first != Pieces::Identities::eNone) {
-        // There is a piece between you and your destination.
-        if (i != columnB) { // If it is not the destination block, somebody is in your way.
-          returnSet = boardCoordinatesType();
-          return returnSet;
-        }
-        else {
-          boardCoordinateType validCoordinate = boardCoordinateType(rowMax, i);
-          returnSet.insert(validCoordinate);
-        }
-        // Already checked the source and destination piece colors
-        // If the identity of the piece on the destination block is not eNone, the move is legal
-      }
-      else {
-        boardCoordinateType validCoordinate = boardCoordinateType(rowMax, i);
-        returnSet.insert(validCoordinate);
-      }
-    }
-    // The for-loop ran it's course, and the return wasn't called.  I call that a success
-    return returnSet;
+  if (!boardStateToEvaluate.isInCheck(colorToEvaluate)) {
+    return true;
   }
 
-  if (columnMin == columnMax) { // The piece moves horizontally as the y-axis value doesn't change
-    if (getCell(pointA)->assignedPiece()->identity() == Pieces::Identities::eBishop) {
-      return returnSet;
-    }
-    // Only need to iterate through the x-axis
-    for (int j = rowA + stepFactorRows; j != rowB + stepFactorRows; j += stepFactorRows) {
-      boardCoordinateType temp = boardCoordinateType(j, columnMax);
-      if (boardStateToSearch.value(temp).first != Pieces::Identities::eNone) {
-        // There is a piece between you and your destination.
-        if (j != rowB) { // If it is not the destination block, somebody is in your way.
-          returnSet = boardCoordinatesType();
-          return returnSet;
-        }
-        else {
-          boardCoordinateType validCoordinate = boardCoordinateType(j, columnMax);
-          returnSet.insert(validCoordinate);
-        }
-        // Already checked the source and destination piece colors
-        // If the identity of the piece on the destination block is not eNone, the move is legal
-      }
-      else {
-        boardCoordinateType validCoordinate = boardCoordinateType(j, columnMax);
-        returnSet.insert(validCoordinate);
-      }
-    }
-    // The for-loop ran it's course, and the return wasn't called.  I call that a success
-    return returnSet;
-  }
-
-  // If we reach this line, it means the move is diagonal.  Apart from the Knight piece
-  // the difference between xMin/xMax and yMin/yMax should be the same, so check that
-  if ((rowMax - rowMin) != (columnMax - columnMin)) { // The poo has hitteth the proverbial fan
-    returnSet = boardCoordinatesType();
-    return returnSet;
-  }
+  // Remember who is attacking whom, the lowest attacker will do if there are more than one
+  squareType kingSquare = boardStateToEvaluate.kingSquare(colorToEvaluate);
+  bitBoardType attackers = boardStateToEvaluate.attackersTo(kingSquare, boardStateToEvaluate.occupancy()) &
+                           boardStateToEvaluate.pieces(PieceColors::flipColor(colorToEvaluate));
+  squareType attackerSquare = BitBoards::lowestSquare(attackers);
 
-  // Special case - target is an adjacent cell
-  if (rowA + stepFactorRows == rowB) {
-    if (newColumn + stepFactorColumns == columnB) {
-      boardCoordinateType validCoordinate = boardCoordinateType(rowB, columnB);
-      returnSet.insert(validCoordinate);
-      return returnSet;
-    }
-  }
-
-  for (int row = rowA + stepFactorRows; row != rowB + stepFactorRows; row += stepFactorRows) {
-    for (int col = newColumn + stepFactorColumns; col != columnB + stepFactorColumns; col += stepFactorColumns) {
-      boardCoordinateType temp = boardCoordinateType(row, col);
-      if (boardStateToSearch.value(temp).first != Pieces::Identities::eNone) {
-        // There is a piece between you and your destination.
-        if (col != columnB && row != rowB) { // If it is not the destination block, somebody is in your way.
-          returnSet = boardCoordinatesType();
-          return returnSet;
-        }
-        // Already checked the source and destination piece colors
-        // If the identity of the piece on the destination block is not eNone, the move is legal
-      }
-      else {
-        boardCoordinateType validCoordinate = boardCoordinateType(row, col);
-        returnSet.insert(validCoordinate);
-      }
-
-      newColumn += stepFactorColumns;
-      break; // ensure x and y step together
-    }
-  }
-  // The for-loop ran it's course, and the return wasn't called.  I call that a success
-  return returnSet;
-}
-
-bool Board::evaluateBoardState(boardStateMapType& boardStateToEvaluate)
-{
-  boardCoordinatesType container;
-  PieceColors::ePieceColors color;
-  color = TurnManager::currentPlayer()->associatedColor();
-
-  boardCoordinateType locationOfAttacker;
-  boardCoordinateType locationOfVictim;
-  definedPieceType    pieceWhoWillBeAttacking;
-  definedPieceType    pieceWhoWillBeAttacked;
-
-  bool kingIsChecked = isTheTargetWithinRange(color, Pieces::Identities::eKing, container, boardStateToEvaluate,
-                                              locationOfAttacker, locationOfVictim, pieceWhoWillBeAttacking, pieceWhoWillBeAttacked);
-
-
-  if (kingIsChecked) {
-    _locationOfAttacker      = locationOfAttacker;
-    _locationOfVictim        = locationOfVictim;
-    _pieceWhoWillBeAttacking = pieceWhoWillBeAttacking;
-    _pieceWhoWillBeAttacked  = pieceWhoWillBeAttacked;
-    return false;
-  }
-
-  return true;
-}
-
-bool Board::isTheTargetWithinRange(PieceColors::ePieceColors colorThatIsToBeAttacked,
-                                   Pieces::Identities::eIdentities identityThatIsToBeAttacked,
-                                   boardCoordinatesType& container,
-                                   boardStateMapType& boardStateToUse,
-                                   boardCoordinateType& locationOfAttacker,
-                                   boardCoordinateType& locationOfVictim,
-                                   definedPieceType& pieceWhoWillBeAttacking,
-                                   definedPieceType& pieceWhoWillBeAttacked)
-{
-  PieceColors::ePieceColors attackerColor = PieceColors::flipColor(colorThatIsToBeAttacked);
-  boardCoordinatesType targetsLocation;
-  boardCoordinateType targetLocation = boardCoordinateType(0, 0);
-
-  boardCoordinateType failure = boardCoordinateType(0, 0);
-  targetsLocation = findPieces(definedPieceType(identityThatIsToBeAttacked, colorThatIsToBeAttacked), boardStateToUse);
-  if (targetsLocation.contains(failure)) {
-    return false;
-  }
-
-  boardCoordinatesType::iterator boardCoordsIterator;
-  boardCoordsIterator = targetsLocation.begin();
-
-
-  for (int i = 0; i < targetsLocation.size(); ++i) {
-
-    targetLocation = *boardCoordsIterator;
-    ++boardCoordsIterator;
-
-    // So now that we know where the target is, iterate through all enemy pieces, map their moves and
-    // see if any legal move includes the target's location.
-    for (int row = eMinRow; row <= eMaxRow; ++row) {
-      for (int column = eMinColumn; column <= eMaxColumn; ++column) {
-        boardCoordinateType currentCoordinate = boardCoordinateType(row, column);
-        definedPieceType currentPiece = boardStateToUse.value(currentCoordinate);
-
-        Pieces::Identities::eIdentities currentPieceIdentity = currentPiece.first;
-        PieceColors::ePieceColors currentPieceColor = currentPiece.second;
-
-        if (currentPieceIdentity == Pieces::Identities::eNone) {
-          // No piece on this cell
-          continue;
-        }
-        if (currentPieceColor != attackerColor) {
-          // Wrong color for attacker
-          continue;
-        }
-        // It is a piece, it is the right color.  Map it's moves
-        movementType rules = MoveRules::getMovementRules(currentPieceIdentity, currentPieceColor);
-
-        mapMoves(rules, currentPiece, container, currentCoordinate, boardStateToUse);
-        definedPieceType pieceToAttack = definedPieceType(identityThatIsToBeAttacked,
-                                                          colorThatIsToBeAttacked); //_currentBoardStateMap.value(currentCoordinate);
-
-        if (container.contains(targetLocation)) {
-          container.clear();
-          locationOfAttacker      = currentCoordinate;
-          locationOfVictim        = targetLocation;
-          pieceWhoWillBeAttacking = currentPiece;
-          pieceWhoWillBeAttacked  = pieceToAttack;
-          container.insert(locationOfVictim);
-          return true;
-        }
-      }
-    }
-  }
-  container.clear();
+  _locationOfAttacker      = BitBoards::coordinate(attackerSquare);
+  _locationOfVictim        = BitBoards::coordinate(kingSquare);
+  _pieceWhoWillBeAttacking = boardStateToEvaluate.pieceOn(attackerSquare);
+  _pieceWhoWillBeAttacked  = boardStateToEvaluate.pieceOn(kingSquare);
   return false;
 }
 
-void Board::movePieceStart(Board* _this, Cell* fromCell, Cell* toCell, boardStateMapType& scenario, piecesListType& scenarioPieces)
+void Board::movePieceStart(boardCoordinateType fromWhere,
+                           boardCoordinateType toWhere,
+                           boardStateMapType& scenario,
+                           piecesListType& scenarioPieces,
+                           Pieces::Identities::eIdentities promotion)
 {
   // back up previous state
   _backedUpBoardStateMap = boardStateMapType(scenario);
@@ -716,7 +367,7 @@ void Board::movePieceStart(Board* _this, Cell* fromCell, Cell* toCell, boardStat
   _stagingCapturedPieces = piecesListType(scenarioPieces);
 
   // Update the staging map
-  _this->updatePieceMap(fromCell, toCell, _stagingBoardStateMap, _stagingCapturedPieces);
+  updatePieceMap(fromWhere, toWhere, _stagingBoardStateMap, _stagingCapturedPieces, promotion);
 
   // transfer the staged state into the scenario
   scenario = boardStateMapType(_stagingBoardStateMap);
@@ -725,9 +376,11 @@ void Board::movePieceStart(Board* _this, Cell* fromCell, Cell* toCell, boardStat
 
 void Board::movePieceCompleteMove(Board* _this, boardStateMapType& scenario)
 {
+  TRACE_SCOPE("Board::movePieceCompleteMove");
+
   _this->redrawBoardFromMap(scenario);
   _this->clearHighLights();
-  _this->uncheckAllCheckedCells();
+  _this->clearSelection();
 
   // Update the ui containers for captured pieces
   _this->updateCapturedPieces();
@@ -745,400 +398,6 @@ void Board::movePieceRevertMove(boardStateMapType& scenario, piecesListType& sce
   scenarioPieces = piecesListType(_backedUpCapturedPieces);
 }
 
-void Board::mapMoves(movementType rules, definedPieceType piece, boardCoordinatesType& container, boardCoordinateType location, boardStateMapType& stateMapToUse)
-{
-  bool lessLinearMoveRequired = false;
-
-  if (!container.isEmpty()) { // QSet < QPair < row, column> >
-    container.clear();
-  }
-
-  int startRow = location.first;
-  int startColumn = location.second;
-
-  directionsType moveDirections = rules.first;
-  magnitudesType moveMagnitudes = rules.second;
-  directionType firstMoveDirections = moveDirections.first;
-  //  directionType secondMoveDirections = moveDirections.second;
-  magnitudeType firstMagnitude = moveMagnitudes.first;
-  magnitudeType secondMagnitude = moveMagnitudes.second;
-
-  // firstMoveDirections are for all pieces
-  // secondMoveDirections are only for Knights
-  // firstMagnitude is mainly a minimum and secondMagnitude is a maximum
-  // except when used for a knight
-
-  if (piece.first == Pieces::Identities::eKnight) {
-    lessLinearMoveRequired = true;
-  }
-
-  if (piece.first == Pieces::Identities::ePawn) {
-    if (piece.second == PieceColors::eBlack) {
-      if (location.first > 2) {
-        secondMagnitude = Magnitude::eOne;
-      }
-      else {
-        secondMagnitude = Magnitude::eTwo;
-      }
-    }
-    else {
-      if (location.first < 7) {
-        secondMagnitude = Magnitude::eOne;
-      }
-      else {
-        secondMagnitude = Magnitude::eTwo;
-      }
-    }
-  }
-
-  if (!lessLinearMoveRequired) {
-
-    directionType::iterator i = firstMoveDirections.begin();
-
-    while (i != firstMoveDirections.end()) {
-
-      Direction::eDirectionRules temp = *i;
-      ++i;
-
-      switch (temp) {
-      case Direction::eMayMoveNorth      : {
-        for (int x = firstMagnitude; x <= secondMagnitude; ++x) {
-          if (startRow - x >= 1) {
-            boardCoordinateType coord = boardCoordinateType(startRow - x, startColumn);
-            container.insert(coord);
-          }
-          else {
-            break;
-          }
-        }
-        break;
-      }
-      case Direction::eMayMoveNorthEast  :
-        for (int x = firstMagnitude; x <= secondMagnitude; ++x) {
-          if (startRow - x >= 1 && startColumn + x <= 8) {
-            boardCoordinateType coord = boardCoordinateType(startRow - x, startColumn + x);
-            container.insert(coord);
-          }
-          else {
-            break;
-          }
-        }
-        break;
-      case Direction::eMayMoveEast       :
-        for (int x = firstMagnitude; x <= secondMagnitude; ++x) {
-          if (startColumn + x <= 8) {
-            boardCoordinateType coord = boardCoordinateType(startRow, startColumn + x);
-            container.insert(coord);
-          }
-          else {
-            break;
-          }
-        }
-        break;
-      case Direction::eMayMoveSouthEast  :
-        for (int x = firstMagnitude; x <= secondMagnitude; ++x) {
-          if (startRow + x <= 8 && startColumn + x <= 8) {
-            boardCoordinateType coord = boardCoordinateType(startRow + x, startColumn + x);
-            container.insert(coord);
-          }
-          else {
-            break;
-          }
-        }
-        break;
-      case Direction::eMayMoveSouth      :
-        for (int x = firstMagnitude; x <= secondMagnitude; ++x) {
-          if (startRow + x <= 8) {
-            boardCoordinateType coord = boardCoordinateType(startRow + x, startColumn);
-            container.insert(coord);
-          }
-          else {
-            break;
-          }
-        }
-        break;
-      case Direction::eMayMoveSouthWest  :
-        for (int x = firstMagnitude; x <= secondMagnitude; ++x) {
-          if (startRow + x <= 8 && startColumn - x >= 1) {
-            boardCoordinateType coord = boardCoordinateType(startRow + x, startColumn - x);
-            container.insert(coord);
-          }
-          else {
-            break;
-          }
-        }
-        break;
-      case Direction::eMayMoveWest       :
-        for (int x = firstMagnitude; x <= secondMagnitude; ++x) {
-          if (startColumn - x >= 1) {
-            boardCoordinateType coord = boardCoordinateType(startRow, startColumn - x);
-            container.insert(coord);
-          }
-          else {
-            break;
-          }
-        }
-        break;
-      case Direction::eMayMoveNorthWest  :
-        for (int x = firstMagnitude; x <= secondMagnitude; ++x) {
-          if (startRow - x >= 1 && startColumn - x >= 1) {
-            boardCoordinateType coord = boardCoordinateType(startRow - x, startColumn - x);
-            container.insert(coord);
-          }
-          else {
-            break;
-          }
-        }
-        break;
-      }
-    }
-  }
-  else { // This is a knight, he doesn't move quite as linear as the other pieces.
-
-    directionType::iterator i = firstMoveDirections.begin();
-
-    while (i != firstMoveDirections.end()) {
-
-      Direction::eDirectionRules temp = *i;
-      ++i;
-
-      switch (temp) {
-      case Direction::eMayMoveNorthEast  :
-        // Knight can move 2 East and 1 North
-        if (startRow - 1 >= 1 && startColumn + 2 <= 8) {
-          boardCoordinateType coord = boardCoordinateType(startRow - 1, startColumn + 2);
-          container.insert(coord);
-        }
-        // Knight can move 1 East and 2 North
-        if (startRow - 2 >= 1 && startColumn + 1 <= 8) {
-          boardCoordinateType coord = boardCoordinateType(startRow - 2, startColumn + 1);
-          container.insert(coord);
-        }
-        break;
-      case Direction::eMayMoveSouthEast  :
-        // Knight can move 2 East and 1 South
-        if (startRow + 1 <= 8 && startColumn + 2 <= 8) {
-          boardCoordinateType coord = boardCoordinateType(startRow + 1, startColumn + 2);
-          container.insert(coord);
-        }
-        // Knight can move 1 East and 2 South
-        if (startRow + 2 <= 8 && startColumn + 1 <= 8) {
-          boardCoordinateType coord = boardCoordinateType(startRow + 2, startColumn + 1);
-          container.insert(coord);
-        }
-        break;
-      case Direction::eMayMoveSouthWest  :
-        // Knight can move 2 West and 1 South
-        if (startRow + 1 <= 8 && startColumn - 2 >= 1) {
-          boardCoordinateType coord = boardCoordinateType(startRow + 1, startColumn - 2);
-          container.insert(coord);
-        }
-        // Knight can move 1 West and 2 South
-        if (startRow + 2 <= 8 && startColumn - 1 >= 1) {
-          boardCoordinateType coord = boardCoordinateType(startRow + 2, startColumn - 1);
-          container.insert(coord);
-        }
-        break;
-      case Direction::eMayMoveNorthWest  :
-        // Knight can move 2 West and 1 North
-        if (startRow - 1 >= 1 && startColumn - 2 >= 1) {
-          boardCoordinateType coord = boardCoordinateType(startRow - 1, startColumn - 2);
-          container.insert(coord);
-        }
-        // Knight can move 1 West and 2 North
-        if (startRow - 2 >= 1 && startColumn - 1 >= 1) {
-          boardCoordinateType coord = boardCoordinateType(startRow - 2, startColumn - 1);
-          container.insert(coord);
-        }
-        break;
-      }
-    }
-  }
-
-  // moves mapped, now remove all the impossible ones
-  if (!container.isEmpty()) {
-    boardCoordinatesType::iterator i = container.begin();
-
-    while (i != container.end()) {
-      boardCoordinateType coordinate = *i;
-      ++i;
-
-      if (!isMoveLegal(location, coordinate, container, stateMapToUse)) {
-        container.remove(coordinate);
-        i = container.begin();
-      }
-    }
-  }
-}
-
-bool Board::isMoveLegal(boardCoordinateType moveFrom,
-                        boardCoordinateType moveTo,
-                        boardCoordinatesType& containerToUse,
-                        boardStateMapType& stateMapToUse)
-{
-  PieceColors::ePieceColors fromColor = stateMapToUse.value(moveFrom).second;
-  PieceColors::ePieceColors toColor = stateMapToUse.value(moveTo).second;
-
-  if (containerToUse.isEmpty()) {
-    return false; // No possible moves for selected piece.
-  }
-
-  boardCoordinateType chosenSpot = moveTo;
-  // Is the choice in the scope of possible moves?  Does the destination contain one of my own pieces?
-  if (containerToUse.contains(chosenSpot) && fromColor != toColor) {
-
-    // Now we have determined the selected piece can travel to the chosen spot (cell) through
-    // it's legal ranges of movement, but, we don't yet know if it can get there (obstructions?)
-
-    int column1 = moveFrom.second;
-    int row1 = moveFrom.first;
-
-    int column2 = moveTo.second;
-    int row2 = moveTo.first;
-
-    int columnMax = column1 > column2 ? column1 : column2;
-    int rowMax = row1 > row2 ? row1 : row2;
-    int columnMin = column1 < column2 ? column1 : column2;
-    int rowMin = row1 < row2 ? row1 : row2;
-
-    int stepFactorX = (column1 < column2) ? 1 : -1;
-    int stepFactorY = (row1 < row2) ? 1 : -1;
-
-    // If the piece in question is a Pawn, and the FROM and TO columns are not the same, there has to be an
-    // enemy piece on the destination cell.  Do a quick check and disqualify if needed.
-    if (stateMapToUse.value(moveFrom).first == Pieces::Identities::ePawn) {
-      if (column1 != column2) {
-
-        // Tried to move horizontally by more than one cell.  Will not be allowed
-        if (columnMax - columnMin > 1) {
-          return false;
-        }
-
-        // Check that the move is 'forward'
-        if (fromColor == PieceColors::eBlack && row1 > row2) {
-          return false;
-        }
-
-        if (fromColor == PieceColors::eWhite && row1 < row2) {
-          return false;
-        }
-
-        // Tried to move sideways (attack), but no enemy on that cell.  Will not be allowed.
-        if (fromColor == PieceColors::eBlack && toColor != PieceColors::eWhite) {
-          return false;
-        }
-        else if (fromColor == PieceColors::eWhite && toColor != PieceColors::eBlack) {
-          return false;
-        }
-        else {
-          return true;
-        }
-      }
-      else {  // Straight move, can only attack sideways, so if destination cell contains
-        // an enemy piece, thwart it
-        if (toColor != PieceColors::eNone) {
-          return false;
-        }
-
-        // In the event a pawn tries to move 2 spaces forward, but the cell between
-        // the pawn and its destination is occupied, it cannot be allowed
-        if (rowMax - rowMin > 1) {
-          if (getCell(rowMax - 1, columnMax)->assignedPiece()->identity() != Pieces::Identities::eNone) {
-            return false;
-          }
-        }
-
-        // Check that the move is 'forward'
-        if (fromColor == PieceColors::eBlack && row1 > row2) {
-          return false;
-        }
-
-        if (fromColor == PieceColors::eWhite && row1 < row2) {
-          return false;
-        }
-
-        // If the code execution reaches this point, we can safely assume the pawn is moving
-        // in a single column, and that the destination cell does not contain an enemy.
-        // Allow it.
-        return true;
-      }
-    }
-
-    // Knights can "jump over" other pieces, so not going to check if anybody is in his way.
-    if (stateMapToUse.value(moveFrom).first != Pieces::Identities::eKnight) {
-
-      // Make a few practical decisions.
-      if (columnMin == columnMax) { // The piece moves vertically as the x-axis value doesn't change
-        // Only need to iterate through the y-axis
-        for (int i = rowMin + 1; i <= rowMax; ++i) {
-          boardCoordinateType temp = boardCoordinateType(i, columnMax);
-          if (stateMapToUse.value(temp).first != Pieces::Identities::eNone) {
-            // There is a piece between you and your destination.
-            if (i != rowMax) { // If it is not the destination block, somebody is in your way.
-              return false;
-            }
-            // Already checked the source and destination piece colors
-            // If the identity of the piece on the destination block is not eNone, the move is legal
-          }
-        }
-        // The for-loop ran it's course, and the return wasn't called.  I call that a success
-        return true;
-      }
-
-      if (rowMin == rowMax) { // The piece moves horizontally as the y-axis value doesn't change
-        // Only need to iterate through the x-axis
-        for (int j = columnMin + 1; j <= columnMax; ++j) {
-          boardCoordinateType temp = boardCoordinateType(rowMax, j);
-          if (stateMapToUse.value(temp).first != Pieces::Identities::eNone) {
-            // There is a piece between you and your destination.
-            if (j != columnMax) { // If it is not the destination block, somebody is in your way.
-              return false;
-            }
-            // Already checked the source and destination piece colors
-            // If the identity of the piece on the destination block is not eNone, the move is legal
-          }
-        }
-        // The for-loop ran it's course, and the return wasn't called.  I call that a success
-        return true;
-      }
-
-      // If we reach this line, it means the move is diagonal.  Apart from the Knight piece
-      // the difference between xMin/xMax and yMin/yMax should be the same, so check that
-      if ((columnMax - columnMin) != (rowMax - rowMin)) { // The poo has hitteth the proverbial fan
-        return false;
-      }
-
-      // Finally, once we reach this line, the check should be easy
-      // Few simple checks
-      int newY = row1;
-
-      for (int col = column1 + stepFactorX; col != column2 + stepFactorX; col += stepFactorX) {
-        for (int row = newY + stepFactorY; row != row2 + stepFactorY; row += stepFactorY) {
-          boardCoordinateType temp = boardCoordinateType(row, col);
-          if (stateMapToUse.value(temp).first != Pieces::Identities::eNone) {
-            // There is a piece between you and your destination.
-            if (col != column2 && row != row2) { // If it is not the destination block, somebody is in your way.
-              return false;
-            }
-            // Already checked the source and destination piece colors
-            // If the identity of the piece on the destination block is not eNone, the move is legal
-          }
-          newY += stepFactorY;
-          break; // ensure x and y step together
-        }
-      }
-      // The for-loop ran it's course, and the return wasn't called.  I call that a success
-      return true;
-    }
-    else {
-      return true;
-    }
-  }
-  else {
-    return false;
-  }
-}
-
 boardStateMapType& Board::stagingBoardStateMap()
 {
   return _stagingBoardStateMap;
@@ -1149,6 +408,11 @@ void Board::setStagingBoardStateMap(const boardStateMapType& stagingBoardStateMa
   _stagingBoardStateMap = stagingBoardStateMap;
 }
 
+GameHistory& Board::gameHistory()
+{
+  return _gameHistory;
+}
+
 boardStateMapType& Board::backedUpBoardStateMap()
 {
   return _backedUpBoardStateMap;
@@ -1204,49 +468,17 @@ void Board::resetBoard(bool styleOnly)
   resetBoard(false, styleOnly);
 }
 
-void Board::uncheckAllCheckedCells()
+void Board::clearSelection()
 {
-  for (int row = 1; row <= 8; ++row)
-    for (int column = 1; column <= 8; ++column) {
-
-      Cell* cell = getCell(row, column);
-
-      if (cell != NULL) {
-        if (cell->isChecked()) {
-          cell->blockSignals(true);
-          cell->setChecked(false);
-          cell->blockSignals(false);
-        }
-      }
-    }
-  Cell::resetCheckedCounter();
+  ui->_boardView->clearSelection();
 }
 
-void Board::redrawBoardFromMap(boardStateMapType currentBoardStateMap)
+void Board::redrawBoardFromMap(const boardStateMapType& currentBoardStateMap)
 {
-  // First, clear the board
-  for (int row = eMinRow; row <= eMaxRow; ++row) {
-    for (int column = eMinColumn; column <= eMaxColumn; ++column) {
-      getCell(row, column)->clearAssignedPiece();
-      //      getCell(row, column)->highLightCell(false);
-    }
-  }
-
-  boardStateMapIteratorType i(currentBoardStateMap);
-
-  while (i.hasNext()) {
-
-    i.next();
-
-    boardCoordinateType coordinate = i.key();
-    definedPieceType piece = i.value();
-
-    Cell* cell = getCell(coordinate.first, coordinate.second);
+  TRACE_SCOPE("Board::redrawBoardFromMap");
+  TRACK_ALLOCATIONS(eRedraw);
 
-    QSharedPointer<Piece> pieceInstance = QSharedPointer<Piece>(new Piece(piece.first, piece.second));
-    cell->assignPiece(pieceInstance);
-
-  }
+  ui->_boardView->setPosition(currentBoardStateMap);
 }
 
 void Board::resetBoard(bool forTheFirstTime, bool styleOnly)
@@ -1255,64 +487,52 @@ void Board::resetBoard(bool forTheFirstTime, bool styleOnly)
   createStartupMap(_backedUpBoardStateMap);
   createStartupMap(_workingBoardStateMap);
   createStartupMap(_stagingBoardStateMap);
+  _gameHistory.reset(_workingBoardStateMap.hash());
 
-  // Initialize the board.
-  for (int row = 1; row <= 8; ++row)
-    for (int column = 1; column <= 8; ++column) {
-
-      Cell* cell = getCell(row, column);
-
-      if (cell != NULL) {
-
-        if (forTheFirstTime) {
-          // What to connect these cells to?
-          connect(cell, SIGNAL(startingANewMove(boardCoordinateType)), this, SLOT(moveInitiated(boardCoordinateType)));
-          connect(cell, SIGNAL(completingMove(boardCoordinateType)), this, SLOT(continueInitiatedMove(boardCoordinateType)));
-          connect(cell, SIGNAL(nothingToDo()), this, SLOT(clearHighLights()));
-          cell->setCoordinate(row, column);
-        }
+  // Nothing has been captured yet in a new game
+  _workingCapturedPieces.clear();
+  _backedUpCapturedPieces.clear();
+  _stagingCapturedPieces.clear();
 
-
-        if (!styleOnly) {
-          initializeBoardCell(cell);
-        }
-      }
-    }
   if (forTheFirstTime) {
-    connect(this, SIGNAL(moveInitiatedComplete(QSharedPointer<Player>&)), this, SLOT(handleMoveInitiatedComplete(QSharedPointer<Player>&)));
+    // The view turns the clicks on its squares into the steps of a move
+    connect(ui->_boardView, SIGNAL(startingANewMove(boardCoordinateType)), this, SLOT(moveInitiated(boardCoordinateType)));
+    connect(ui->_boardView, SIGNAL(completingMove(boardCoordinateType)), this, SLOT(continueInitiatedMove(boardCoordinateType)));
+    connect(ui->_boardView, SIGNAL(nothingToDo()), this, SLOT(clearHighLights()));
+    connect(ui->_boardView, SIGNAL(premoveQueued(boardMoveType)), this, SLOT(queuePremove(boardMoveType)));
+    connect(ui->_boardView, SIGNAL(premovesCancelled()), this, SLOT(cancelPremoves()));
   }
-  setEnabled(true);
-}
-
-Cell* Board::getCell(int row, int column) const
-{
-  QGridLayout* parentLayout = ui->gridLayout;
-  Cell* theRealCell = NULL;
 
-  QLayoutItem* theCell;
-  theCell = parentLayout->itemAtPosition(row, column);
+  // Back to the regular colours, with nothing selected or queued
+  clearHighLights();
+  clearSelection();
+  cancelPremoves();
 
-  QWidget* closerToTheRealCell;
-  closerToTheRealCell = theCell->widget();
-
-  theRealCell = dynamic_cast<Cell*>(closerToTheRealCell);
-  return theRealCell;
+  if (!styleOnly) {
+    redrawBoardFromMap(_workingBoardStateMap);
+  }
+  updateCapturedPieces();
+  setEnabled(true);
 }
 
-Cell* Board::getCell(boardCoordinateType position) const
+void Board::loadPosition(const boardStateMapType& position, int halfmoveClock)
 {
-  return getCell(position.first, position.second);
-}
+  _workingBoardStateMap  = position;
+  _backedUpBoardStateMap = position;
+  _stagingBoardStateMap  = position;
 
-void Board::initializeBoardCell(Cell* cell)
-{
-  boardCoordinateType coordinate(cell->position());
-  definedPieceType piece = _workingBoardStateMap.value(coordinate);
+  _workingCapturedPieces.clear();
+  _backedUpCapturedPieces.clear();
+  _stagingCapturedPieces.clear();
 
-  // This cell needs a piece
-  QSharedPointer<Piece> pieceInstance = QSharedPointer<Piece>(new Piece(piece.first, piece.second));
+  _gameHistory.reset(position.hash(), halfmoveClock);
 
-  cell->assignPiece(pieceInstance);
+  redrawBoardFromMap(_workingBoardStateMap);
+  clearHighLights();
+  clearSelection();
+  cancelPremoves();
+  updateCapturedPieces();
+  setEnabled(true);
 }
 
 void Board::createStartupMap(boardStateMapType& mapToInitialize)
@@ -1365,6 +585,9 @@ void Board::createStartupMap(boardStateMapType& mapToInitialize)
           }
         }
       }
+
+    // Nothing has moved yet, so both Players may castle to both sides
+    mapToInitialize.setCastlingRights(CastlingRights::eAll);
   }
   else {
     mapToInitialize.clear();
@@ -10,13 +10,13 @@
 
 #include "Pieces.h"
 #include "UserIdentity.h"
-#include "MoveRules.h"
 #include "Player.h"
 #include "CommonTypeDefinitions.h"
+#include "GameState.h"
+#include "GameHistory.h"
 
 #include <QWidget>
 
-class Cell;
 
 namespace Ui
 {
@@ -54,8 +54,8 @@ public:
     eKnightRightColumn = 7, ///< enum value eKnightRightColumn represents the default column for knights at the right the Board.
     eBishopLeftColumn  = 3, ///< enum value eBishopLeftColumn represents the default column for bishops at the left the Board.
     eBishopRightColumn = 6, ///< enum value eBishopRightColumn represents the default column for bishops at the right the Board.
-    eKingColumn        = 4, ///< enum value eKingColumn represents the default column for kings on the Board.
-    eQueenColumn       = 5  ///< enum value eQueenColumn represents the default column for queens on the Board.
+    eKingColumn        = 5, ///< enum value eKingColumn represents the default column for kings on the Board.
+    eQueenColumn       = 4  ///< enum value eQueenColumn represents the default column for queens on the Board.
   };
 
   ///
@@ -76,91 +76,55 @@ public:
   virtual ~Board();
 
   ///
-  /// updatePieceMap takes a given state map, and "performs a move" from one Cell to another.
+  /// updatePieceMap takes a given state map, and "performs a move" from one cell to another.
   ///
-  /// \param from [in] is the Cell where the piece that will be moved resides in the given state map.
-  /// \param to [in] is the Cell where the piece will be moved to within the same state map.
+  /// A King moving two columns castles, a pawn reaching the last row is promoted.
+  ///
+  /// \param fromCoords [in] is the cell where the piece that will be moved resides in the given state map.
+  /// \param toCoords [in] is the cell where the piece will be moved to within the same state map.
   /// \param boardStateMap [in,out] the board state map to be used during the move.
   /// \param capturedPiecesContainer [in,out] is a list used to keep track of captured pieces.
+  /// \param promotion [in] is the identity a pawn reaching the last row becomes.
   ///
-  void updatePieceMap(Cell* from, Cell* to, boardStateMapType& boardStateMap, piecesListType& capturedPiecesContainer);
-
-  ///
-  /// getCell returns a pointer to a Cell on the Board.
-  ///
-  /// \param row [in] the row coordinate of the Cell to be returned.
-  /// \param column [in] the column coordinate of the Cell to be returned.
-  /// \return a Cell pointer of the Cell at (row,column).
-  ///
-  Cell* getCell(int row, int column) const;
-
-  ///
-  /// getCell overloaded version that combines row and column into boardCoordinateType.
-  ///
-  /// \param position [in] the boardCoordinate of the Cell to be returned.
-  /// \return the Cell at position.
-  ///
-  Cell* getCell(boardCoordinateType position) const;
+  static void updatePieceMap(boardCoordinateType fromCoords,
+                             boardCoordinateType toCoords,
+                             boardStateMapType& boardStateMap,
+                             piecesListType& capturedPiecesContainer,
+                             Pieces::Identities::eIdentities promotion = Pieces::Identities::eQueen);
 
   ///
-  /// resetBoard resets the Board, Cells, Containers, and can also connect signals/slots.
+  /// resetBoard resets the Board, its BoardView, Containers, and can also connect signals/slots.
   ///
-  /// \param forTheFirstTime [in] determines whether the signals from cells have to be connected.
-  /// \param styleOnly [in] determines whether a Cell will be styled only, or also be allocated a piece.
+  /// \param forTheFirstTime [in] determines whether the signals from the BoardView have to be connected.
+  /// \param styleOnly [in] determines whether the highlights and selection are cleared only, or the pieces are redrawn too.
   ///
   void resetBoard(bool forTheFirstTime, bool styleOnly);
 
   ///
-  /// getPath calculates a direct path between two points on the Board.
-  ///
-  /// The state is needed, as in two different scenarios, pieces on the board may be in different places, and
-  /// a crucial element to whether a path between pieces exist, is that there may be no other pieces
-  /// on the path between them.
-  ///
-  /// \param pointA [in] is the start coordinate of the path to be calculated.
-  /// \param pointB [in] is the end coordinate of the path to be calculated.
-  /// \param boardStateToSearch [in] is the state to use when calculating the path.
-  /// \return the se of coordinates that represent the path between pointA and pointB.
-  ///
-  boardCoordinatesType getPath(boardCoordinateType pointA,
-                               boardCoordinateType pointB,
-                               boardStateMapType& boardStateToSearch);
-
+  /// loadPosition replaces the game in progress by a position, e.g. one read with GameState::readFen().
   ///
-  /// mapMoves produces a map of technically correct moves for a piece based on the rules supplied.
+  /// The position becomes the working, backed up and staging state, the captured pieces are forgotten,
+  /// the game history starts over from the position, and the BoardView is redrawn to show it.
   ///
-  /// \param rules [in] a list of directions and magnitudes that represents what is legal for piece.
-  /// \param piece [in] the piece to be mapped.
-  /// \param container [in,out] the container to stored the mapped moves in.
-  /// \param location [in] the starting location of the piece in question.
-  /// \param stateMapToUse [in] is the map used to determine possible moves when calling isMoveLegal.
+  /// \param position [in] the position to play on from.
+  /// \param halfmoveClock [in] the number of moves made since the last capture or pawn move.
   ///
-  void mapMoves(movementType rules, definedPieceType piece, boardCoordinatesType& container, boardCoordinateType location, boardStateMapType& stateMapToUse);
+  void loadPosition(const boardStateMapType& position, int halfmoveClock = 0);
 
   ///
-  /// findPieces is a replacement for the two findPiece functions.
-  ///
-  /// The reason for replacing the findPiece functions with this one, was that with the exception of
-  /// King and Queen, there may be more than just one of each piece definition on the board at
-  /// any given time.
-  ///
-  /// \param piece [in] is the identity and color as definedPieceType of the pieces to find.
-  /// \param boardStateToSearch [in] is the state that will be searched to locate the pieces in question.
-  /// \return the boardCoordinatesType defined as a QSet<boardCoordinateType> containing the search result(s).
-  ///
-  boardCoordinatesType findPieces(definedPieceType piece, boardStateMapType& boardStateToSearch);
-
+  /// evaluateBoardState determines whether the king of the given colour is in danger.
   ///
-  /// evaluateBoardState determines whether the king of the current Player is in danger.
+  /// Only the square of the king is tested against the attacks of the enemy pieces (see GameState::isInCheck),
+  /// so this is cheap enough to call for every move that is considered.
   ///
   /// Example usage:
   /// \code
-  ///  bool isCurrentStateValid = evaluateBoardState (currentBoardState);
+  ///  bool isCurrentStateValid = evaluateBoardState (currentBoardState, PieceColors::eWhite);
   ///  if (isCurrentStateValid) {
-  ///    movePieceStart (this, fromCell, toCell, currentBoardState, currentCapturedPiecesList);
+  ///    movePieceStart (fromWhere, toWhere, currentBoardState, currentCapturedPiecesList);
   ///  }
   ///
-  ///  bool isCurrentStateStillValid  = evaluateBoardState (currentBoardState);
+  ///  bool isCurrentStateStillValid  = evaluateBoardState (currentBoardState, PieceColors::eWhite);
   ///  if (isCurrentStateStillValid) {
   ///    movePieceCompleteMove (this, currentBoardState);
   ///  }
@@ -170,24 +134,27 @@ public:
   /// \endcode
   ///
   /// \param boardStateToEvaluate [in] is the board state to be evaluated.
+  /// \param colorToEvaluate [in] is the colour of the king that must not be checked.
   /// \return the state "validity" of the board (true = king is not checked, i.e. Board state is valid).
   ///
-  bool evaluateBoardState(boardStateMapType& boardStateToEvaluate);
+  bool evaluateBoardState(boardStateMapType& boardStateToEvaluate, PieceColors::ePieceColors colorToEvaluate);
 
   ///
   /// movePieceStart prepares the state management to validate and commit a move.
   ///
-  /// \param _this [in] is the Board instance pointer, needed because movePieceStart is a static function.
-  /// \param fromCell [in] the Cell to move from.
-  /// \param toCell [in] the Cell to move to.
+  /// No widget is touched, so the engine and the benchmarks may stage moves without a Board.
+  ///
+  /// \param fromWhere [in] the cell to move from.
+  /// \param toWhere [in] the cell to move to.
   /// \param scenario [in,out] the board state map on which the move is to be "staged" for validation.
   /// \param scenarioPieces [in,out] the list of captured pieces that accompanies the board state.
+  /// \param promotion [in] the identity a pawn reaching the last row becomes.
   ///
-  static void movePieceStart(Board* _this,
-                             Cell* fromCell,
-                             Cell* toCell,
+  static void movePieceStart(boardCoordinateType fromWhere,
+                             boardCoordinateType toWhere,
                              boardStateMapType& scenario = _workingBoardStateMap,
-                             piecesListType& scenarioPieces = _workingCapturedPieces);
+                             piecesListType& scenarioPieces = _workingCapturedPieces,
+                             Pieces::Identities::eIdentities promotion = Pieces::Identities::eQueen);
 
   ///
   /// movePieceCompleteMove completes a move (\see movePieceStart ).
@@ -290,6 +257,13 @@ public:
   ///
   static void setStagingBoardStateMap(const boardStateMapType& stagingBoardStateMap);
 
+  ///
+  /// gameHistory accessor to the positions reached in the current game, used to detect repetitions and the fifty-move rule.
+  ///
+  /// \return the history of the current game.
+  ///
+  static GameHistory& gameHistory();
+
   ///
   /// humanPlayer returns the human Player Object.
   ///
@@ -322,28 +296,6 @@ public:
   ///
   void setAiPlayer(const QSharedPointer<Player>& aiPlayer);
 
-  ///
-  /// isTheTargetWithinRange determines if any piece of the opposing side is able to attack a given piece.
-  ///
-  /// \param colorThatIsToBeAttacked [in] the color (black or white) of the piece to be attacked.
-  /// \param identityThatIsToBeAttacked [in] the identity (pawn, king, knight, etc.) of the piece to be attacked.
-  /// \param container [in,out] is a container used to output the location of the piece to be attacked.
-  /// \param boardStateToUse [in] is the state of the Board to use when mapping the attack.
-  /// \param locationOfAttacker [out] is the location of any piece that can attack the "victim".
-  /// \param locationOfVictim [out] is the location of the piece that will be attacked.
-  /// \param pieceWhoWillBeAttacking [out] the definedPieceType value of the attacker.
-  /// \param pieceWhoWillBeAttacked [out] the definedPieceType value of the victim.
-  /// \return true if the target can be reached, false if it cannot.
-  ///
-  bool isTheTargetWithinRange(PieceColors::ePieceColors colorThatIsToBeAttacked,
-                              Pieces::Identities::eIdentities identityThatIsToBeAttacked,
-                              boardCoordinatesType& container,
-                              boardStateMapType& boardStateToUse,
-                              boardCoordinateType& locationOfAttacker,
-                              boardCoordinateType& locationOfVictim,
-                              definedPieceType& pieceWhoWillBeAttacking,
-                              definedPieceType& pieceWhoWillBeAttacked);
-
   ///
   /// locationOfAttacker returns the board coordinate of the king's attacker, when state evaluation returns as invalid.
   ///
@@ -401,40 +353,29 @@ public:
   void setPieceWhoWillBeAttacked(const definedPieceType& pieceWhoWillBeAttacked);
 
   ///
-  /// uncheckAllCheckedCells does what its name suggests. It unchecks all the cells on the Board.
+  /// clearSelection forgets the piece selected by the first step of a move, if any.
   ///
-  void uncheckAllCheckedCells();
+  void clearSelection();
 
   ///
   /// highLightCoordinates simply does as the name says. It highlights board cells by coordinate.
   ///
   /// This function is generally used to display the valid moves a selected piece can make.
   ///
-  /// \param set [in] is a QSet<boardCoordinateType> that contains Cell coordinates to highlight.
+  /// \param set [in] is a QSet<boardCoordinateType> that contains cell coordinates to highlight.
   ///
   void highLightCoordinates(boardCoordinatesType& set);
 
   ///
-  /// toggleCell is a function used by the AI to simulate the clicking of a checkable Cell.
-  ///
-  /// \param cell [in] is the Cell that the AI wants to "click".
+  /// playMove plays a move for the Player whose turn it is, without it being clicked, as the AI does.
   ///
-  void toggleCell(Cell* cell);
-
-  ///
-  /// isMoveLegal determines whether a mapped move can be allowed.
+  /// The move is looked up in the legal moves of the working state (see MoveMapper::isLegalMove), and
+  /// played just as if its two squares had been clicked.
   ///
-  /// \param moveFrom [in] where the piece is.
-  /// \param moveTo [in] where the piece wants to go.
-  /// \param containerToUse [in] the set of coordinates to use in checking the legality of the move.
-  /// \param stateMapToUse [in] the board state to use for the evaluation.
-  /// \return true if the move can be allowed, false if not.
+  /// \param move [in] is the cell to move from (first), the cell to move to (second) and the promotion, a Queen if none is named.
+  /// \return true if the move was legal and has been played, false if it was not.
   ///
-  bool isMoveLegal(boardCoordinateType moveFrom,
-                   boardCoordinateType moveTo,
-                   boardCoordinatesType&
-                   containerToUse,
-                   boardStateMapType& stateMapToUse);
+  bool playMove(const boardMoveType& move);
 
 public slots:
   ///
@@ -443,18 +384,6 @@ public slots:
   void clearHighLights();
 
 signals:
-  ///
-  /// moveInitiatedComplete signal is emitted after the first step of a move is completed.
-  ///
-  /// \param playerWhoInitiated [in] the Player that is making a move.
-  ///
-  void moveInitiatedComplete(QSharedPointer<Player>& playerWhoInitiated);
-
-  ///
-  /// aiMoveCompletionRequired is the signal emitted to make sure the AI completes an initiated move.
-  ///
-  void aiMoveCompletionRequired();
-
   ///
   /// updateCapturedPiecesSignal signal that is emitted to ensure the GUI containers with captured pieces update.
   ///
@@ -472,26 +401,23 @@ private slots:
   ///
   /// continueInitiatedMove is the second leg of a move initiated previously, \see moveInitiated.
   ///
+  /// A pawn clicked onto the last row is promoted to the piece the Player picks, \see askForPromotion.
+  ///
   /// \param whereTo [in] is the destination cell for the second leg of the move.
   ///
   void continueInitiatedMove(boardCoordinateType whereTo);
 
   ///
-  /// handleMoveInitiatedComplete starts a timer of 400ms after a move initiation has completed.
+  /// queuePremove queues a move made while the AI is thinking, to be played as soon as the AI has replied.
   ///
-  /// A human would normally complete both steps of a movement without being prompted to do so.
-  /// The AI however is not quite human, and requires some encouragement, hence the timer and timerEvent.
+  /// \param premove [in] is the cell to move from (first) and the cell to move to (second).
   ///
-  /// \param playerWhoInitiated [in] is either the AI (aiPlayer) or the human participant (humanPlayer).
-  ///
-  void handleMoveInitiatedComplete(QSharedPointer<Player>& playerWhoInitiated);
+  void queuePremove(boardMoveType premove);
 
   ///
-  /// timerEvent is called when the 400ms timer fires an event. \see handleMoveInitiatedComplete.
-  ///
-  /// \param event [in] details the event that fired.
+  /// cancelPremoves calls off every premove queued.
   ///
-  void timerEvent(QTimerEvent* event);
+  void cancelPremoves();
 
 private:
 
@@ -530,6 +456,11 @@ private:
   ///
   static piecesListType _stagingCapturedPieces;
 
+  ///
+  /// _gameHistory is the private member that holds the positions reached in the current game.
+  ///
+  static GameHistory _gameHistory;
+
   ///
   /// _locationStart is the private member that holds the starting position of a move in progress.
   ///
@@ -540,11 +471,22 @@ private:
   ///
   boardCoordinateType _locationEnd;
 
+  ///
+  /// _promotion is the private member that holds the identity a pawn of the move in progress becomes on the last row.
+  /// It is Pieces::Identities::eNone while nobody named one, in which case the human Player is asked.
+  ///
+  Pieces::Identities::eIdentities _promotion;
+
   ///
   /// _containerForMoving is the private member that stores all possible locations an allowed move can result in.
   ///
   boardCoordinatesType _containerForMoving;
 
+  ///
+  /// _premoves is the private member that stores the premoves queued while the AI was thinking, the first to be played first.
+  ///
+  boardMovesType _premoves;
+
   ///
   /// _humanPlayer stores a shared pointer to the human Player object.
   ///
@@ -586,11 +528,21 @@ private:
   void resetBoard(bool styleOnly);
 
   ///
-  /// initializeBoardCell assigns a piece to a Cell, determined by the working state map.
+  /// playPremove plays the first premove queued, once the AI has replied.
+  ///
+  /// The premove is only validated now, against the position the reply of the AI left.  If it is not
+  /// legal, it is dropped along with every premove queued after it, as those were planned on top of it.
+  ///
+  /// \return true if a premove has been played, false if none was queued or it was not legal.
+  ///
+  bool playPremove();
+
+  ///
+  /// askForPromotion asks the human Player which piece a pawn reaching the last row becomes.
   ///
-  /// \param cell [in] the cell that will have a piece allocated to it.
+  /// \return the identity picked, or Pieces::Identities::eNone if the question was cancelled.
   ///
-  void initializeBoardCell(Cell* cell);
+  Pieces::Identities::eIdentities askForPromotion();
 
   ///
   /// createStartupMap creates a map with starting positions of a chess game.
@@ -603,36 +555,11 @@ private:
   /// redrawBoardFromMap does what its name suggests.
   ///
   /// After a move completes, the new board state has to be drawn to
-  /// visually "make the move".
+  /// visually "make the move".  Only the squares that changed are repainted.
   ///
   /// \param currentBoardStateMap [in] the state that will be drawn.
   ///
-  void redrawBoardFromMap(boardStateMapType currentBoardStateMap);
-
-  ///
-  /// findPiece finds a piece defined by color and identity (pawn, knight, etc).
-  ///
-  /// This implementation is a parameter overloaded version of the one that combines identity and color into definedPieceType.
-  ///
-  /// \param colorThatIsToBeFound [in] is the PieceColors::ePieceColors value that represents the colour of the piece to be found.
-  /// \param identityThatIsToBeFound [in] is the Pieces::Identities::eIdentities value that represents the identity of the piece to be found.
-  /// \param boardStateToUse [in] the board state to search for the piece in question.
-  /// \return the coordinate where the piece can be found.
-  ///
-  boardCoordinateType findPiece(PieceColors::ePieceColors colorThatIsToBeFound,
-                                Pieces::Identities::eIdentities identityThatIsToBeFound,
-                                boardStateMapType& boardStateToUse);
-
-  ///
-  /// findPiece finds a piece defined by color and identity (pawn, knight, etc), combined as definedPieceType.
-  ///
-  /// This implementation is called by a parameter overloaded version of the one that takes identity and color separately.
-  ///
-  /// \param piece [in] a definedPieceType variable that contains the color and identity of the piece to be searched for.
-  /// \param boardStateToUse [in] the board state to search for the piece in question.
-  /// \return the coordinate where the piece can be found.
-  ///
-  boardCoordinateType findPiece(definedPieceType piece, boardStateMapType& boardStateToUse);
+  void redrawBoardFromMap(const boardStateMapType& currentBoardStateMap);
 
   ///
   /// updateCapturedPieces emits a signal to the Chess class to update the captured piece containers on the UI.
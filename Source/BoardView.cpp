@@ -0,0 +1,581 @@
+///
+/// \file   BoardView.cpp
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This file contains the inner management features of the BoardView class.
+///
+/// In this cpp file is housed all the functions and attributes needed to draw a Chess Board, and to
+/// turn the clicks of the mouse on it into moves.
+///
+
+#include "BoardView.h"
+
+#include "BitBoards.h"
+#include "PiecePixmapCache.h"
+#include "TurnManager.h"
+#include "AllocationTracker.h"
+#include "TurnTracer.h"
+
+#include <QApplication>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QPaintEvent>
+#include <QResizeEvent>
+#include <QVariantAnimation>
+
+BoardView::BoardView(QWidget* parent) :
+  QWidget(parent),
+  _selection(boardCoordinateType(0, 0)),
+  _slide(new QVariantAnimation(this)),
+  _slideFrom(boardCoordinateType(0, 0)),
+  _slideTo(boardCoordinateType(0, 0)),
+  _slideProgress(0.0),
+  _legalTargets(0),
+  _dragFrom(boardCoordinateType(0, 0)),
+  _dragging(false),
+  _deselectOnRelease(false),
+  _dropping(false),
+  _hovered(boardCoordinateType(0, 0)),
+  _premoveSquares(0),
+  _squareSize(0),
+  _pieceSize(0),
+  _pixelRatio(1.0)
+{
+  for (int square = 0; square < eSquares; ++square) {
+    _highlighted[square] = false;
+  }
+
+  _slide->setStartValue(0.0);
+  _slide->setEndValue(1.0);
+  _slide->setDuration(eSlideDuration);
+  _slide->setEasingCurve(QEasingCurve::OutCubic);
+  connect(_slide, SIGNAL(valueChanged(QVariant)), this, SLOT(advanceSlide(QVariant)));
+  connect(_slide, SIGNAL(finished()), this, SLOT(finishSlide()));
+
+  // The four styles of a square are parsed once, highlights merely being a lighter shade of the regular colours
+  _squareColors[CellColors::eBrown][0] = QColor(CellColors::getInstance().getBrown());
+  _squareColors[CellColors::eBrown][1] = QColor(CellColors::getInstance().getHiBrown());
+  _squareColors[CellColors::eBeige][0] = QColor(CellColors::getInstance().getBeige());
+  _squareColors[CellColors::eBeige][1] = QColor(CellColors::getInstance().getHiBeige());
+}
+
+BoardView::~BoardView()
+{
+
+}
+
+void BoardView::setPosition(const boardStateMapType& position)
+{
+  // A piece still sliding lands at once, as the square it slides to may be about to change
+  stopSlide();
+
+  // A square changed if any piece left or entered it, usually two of them, four when castling
+  bitBoardType changed = 0;
+  for (int color = PieceColors::eBlack; color <= PieceColors::eMax; ++color) {
+    for (int identity = Pieces::Identities::ePawn; identity <= Pieces::Identities::eMax; ++identity) {
+      PieceColors::ePieceColors pieceColor = static_cast<PieceColors::ePieceColors>(color);
+      Pieces::Identities::eIdentities pieceIdentity = static_cast<Pieces::Identities::eIdentities>(identity);
+      changed |= _position.pieces(pieceColor, pieceIdentity) ^ position.pieces(pieceColor, pieceIdentity);
+    }
+  }
+
+  _position = position;
+
+  while (changed) {
+    update(squareRect(BitBoards::coordinate(BitBoards::popLowestSquare(changed))));
+  }
+}
+
+definedPieceType BoardView::pieceAt(boardCoordinateType coordinate) const
+{
+  return _position.pieceOn(BitBoards::square(coordinate));
+}
+
+void BoardView::setHighlighted(boardCoordinateType coordinate, bool highLight)
+{
+  squareType square = BitBoards::square(coordinate);
+
+  if (_highlighted[square] != highLight) {
+    _highlighted[square] = highLight;
+    update(squareRect(coordinate));
+  }
+}
+
+void BoardView::clearHighlights()
+{
+  for (int square = 0; square < eSquares; ++square) {
+    if (_highlighted[square]) {
+      _highlighted[square] = false;
+      update(squareRect(BitBoards::coordinate(squareType(square))));
+    }
+  }
+}
+
+void BoardView::clearSelection()
+{
+  _selection = boardCoordinateType(0, 0);
+  _legalTargets = 0;
+}
+
+void BoardView::setLegalTargets(bitBoardType targets)
+{
+  _legalTargets = targets;
+}
+
+bool BoardView::isLegalTarget(boardCoordinateType coordinate) const
+{
+  return (_legalTargets & BitBoards::squareBit(BitBoards::square(coordinate))) != 0;
+}
+
+boardCoordinateType BoardView::selection() const
+{
+  return _selection;
+}
+
+void BoardView::setPremoves(const boardMovesType& premoves)
+{
+  bitBoardType squares = 0;
+  for (int index = 0; index < premoves.size(); ++index) {
+    squares |= BitBoards::squareBit(BitBoards::square(premoves.at(index).first));
+    squares |= BitBoards::squareBit(BitBoards::square(premoves.at(index).second));
+  }
+
+  // Only the squares that are marked or no longer marked are repainted
+  bitBoardType changed = squares ^ _premoveSquares;
+  _premoveSquares = squares;
+  _premoves = premoves;
+  while (changed != 0) {
+    update(squareRect(BitBoards::coordinate(BitBoards::popLowestSquare(changed))));
+  }
+}
+
+void BoardView::clickSquare(boardCoordinateType coordinate)
+{
+  TRACE_SCOPE("BoardView::clickSquare");
+
+  if (TurnManager::currentPlayer().isNull()) {
+    return;
+  }
+
+  // While the AI is thinking, the human Player picks his own pieces to queue premoves with, where the
+  // premoves queued before leave them
+  bool premoving = TurnManager::currentPlayer()->identity() != UserIdentity::eHuman;
+  PieceColors::ePieceColors playerColor = TurnManager::currentPlayer()->associatedColor();
+  bool ownPiece = false;
+  if (premoving) {
+    playerColor = PieceColors::flipColor(playerColor);
+    ownPiece = (premovedPieces(playerColor) & BitBoards::squareBit(BitBoards::square(coordinate))) != 0;
+  }
+  else {
+    ownPiece = pieceAt(coordinate).second == playerColor;
+  }
+
+  // Starting a new move, which only the Player whose turn it is can do with his own pieces
+  if (_selection == boardCoordinateType(0, 0)) {
+    if (!ownPiece) {
+      return;
+    }
+
+    _selection = coordinate;
+    setHighlighted(coordinate, true);
+
+    if (premoving) {
+      // Whether a premove is legal is only known once the AI has moved, so any other square will do for now
+      setLegalTargets(~BitBoards::squareBit(BitBoards::square(coordinate)));
+    }
+    else {
+      emit startingANewMove(coordinate);
+    }
+    return;
+  }
+
+  // Changed your mind?  Clicking a piece of your own calls the move off, and picks that piece instead.
+  // A premove may end on a piece of your own, to recapture there, so only the piece selected calls it off.
+  if (premoving ? coordinate == _selection : ownPiece) {
+    bool pickAnother = coordinate != _selection;
+
+    clearSelection();
+    emit nothingToDo();
+
+    if (pickAnother) {
+      clickSquare(coordinate);
+    }
+    return;
+  }
+
+  // Completing the move, the Board decides whether it is allowed, now or once the AI has moved
+  boardCoordinateType from = _selection;
+  clearSelection();
+
+  if (premoving) {
+    emit premoveQueued(boardMoveType(from, coordinate, premovePromotion(from, coordinate)));
+  }
+  else {
+    emit completingMove(coordinate);
+  }
+}
+
+bitBoardType BoardView::premovedPieces(PieceColors::ePieceColors color) const
+{
+  bitBoardType pieces = _position.pieces(color);
+  for (int index = 0; index < _premoves.size(); ++index) {
+    bitBoardType from = BitBoards::squareBit(BitBoards::square(_premoves.at(index).first));
+    if (pieces & from) {
+      pieces &= ~from;
+      pieces |= BitBoards::squareBit(BitBoards::square(_premoves.at(index).second));
+    }
+  }
+  return pieces;
+}
+
+Pieces::Identities::eIdentities BoardView::premovePromotion(boardCoordinateType from, boardCoordinateType to) const
+{
+  // Follow the piece back through the premoves queued, to the square it stands on now
+  boardCoordinateType origin = from;
+  for (int index = _premoves.size() - 1; index >= 0; --index) {
+    if (_premoves.at(index).second == origin) {
+      origin = _premoves.at(index).first;
+    }
+  }
+
+  const definedPieceType& piece = _position.pieceOn(BitBoards::square(origin));
+  if (piece.first != Pieces::Identities::ePawn ||
+      (BitBoards::promotionRow(piece.second) & BitBoards::squareBit(BitBoards::square(to))) == 0) {
+    return Pieces::Identities::eNone;
+  }
+
+  Qt::KeyboardModifiers modifiers = QApplication::keyboardModifiers();
+  if (modifiers & Qt::ControlModifier) {
+    return Pieces::Identities::eKnight;
+  }
+  if (modifiers & Qt::ShiftModifier) {
+    return Pieces::Identities::eCastle;
+  }
+  if (modifiers & Qt::AltModifier) {
+    return Pieces::Identities::eBishop;
+  }
+  return Pieces::Identities::eQueen;
+}
+
+void BoardView::slidePiece(boardCoordinateType from, boardCoordinateType to)
+{
+  stopSlide();
+
+  // A piece dropped where it was dragged to is already there
+  if (_dropping || from == to || pieceAt(to).first == Pieces::Identities::eNone) {
+    return;
+  }
+
+  _slideFrom = from;
+  _slideTo = to;
+  _slideProgress = 0.0;
+
+  update(slideRect());
+  update(squareRect(to));
+  _slide->start();
+}
+
+void BoardView::advanceSlide(const QVariant& progress)
+{
+  if (_slideTo == boardCoordinateType(0, 0)) {
+    return;
+  }
+
+  QRect before = slideRect();
+  _slideProgress = progress.toReal();
+  update(before.united(slideRect()));
+}
+
+void BoardView::finishSlide()
+{
+  if (_slideTo == boardCoordinateType(0, 0)) {
+    return;
+  }
+
+  update(slideRect());
+  update(squareRect(_slideTo));
+
+  _slideFrom = boardCoordinateType(0, 0);
+  _slideTo = boardCoordinateType(0, 0);
+  _slideProgress = 0.0;
+}
+
+void BoardView::stopSlide()
+{
+  if (_slide->state() != QAbstractAnimation::Stopped) {
+    _slide->stop();
+    finishSlide();
+  }
+}
+
+QRect BoardView::dragRect() const
+{
+  return QRect(_dragPosition.x() - _squareSize / 2, _dragPosition.y() - _squareSize / 2, _squareSize, _squareSize);
+}
+
+QRect BoardView::slideRect() const
+{
+  QRect from = squareRect(_slideFrom);
+  QRect to = squareRect(_slideTo);
+
+  return QRect(from.x() + qRound((to.x() - from.x()) * _slideProgress),
+               from.y() + qRound((to.y() - from.y()) * _slideProgress),
+               _squareSize,
+               _squareSize);
+}
+
+boardCoordinateType BoardView::squareAt(const QPoint& point) const
+{
+  if (_squareSize <= 0) {
+    return boardCoordinateType(0, 0);
+  }
+
+  int x = point.x() - _origin.x();
+  int y = point.y() - _origin.y();
+  int boardSize = 8 * _squareSize;
+
+  if (x < 0 || y < 0 || x >= boardSize || y >= boardSize) {
+    return boardCoordinateType(0, 0);
+  }
+
+  return boardCoordinateType(y / _squareSize + 1, x / _squareSize + 1);
+}
+
+QRect BoardView::squareRect(boardCoordinateType coordinate) const
+{
+  return QRect(_origin.x() + (coordinate.second - 1) * _squareSize,
+               _origin.y() + (coordinate.first - 1) * _squareSize,
+               _squareSize,
+               _squareSize);
+}
+
+void BoardView::paintEvent(QPaintEvent* event)
+{
+  TRACE_SCOPE("BoardView::paintEvent");
+  TRACK_ALLOCATIONS(eRedraw);
+
+  // Moved to a screen of another pixel density, the images are made again to stay crisp
+  if (PiecePixmapCache::devicePixelRatio(this) != _pixelRatio) {
+    renderSquareTiles();
+    scalePiecePixmaps();
+  }
+
+  QPainter painter(this);
+
+  for (int square = 0; square < eSquares; ++square) {
+    boardCoordinateType coordinate = BitBoards::coordinate(squareType(square));
+    QRect rect = squareRect(coordinate);
+
+    if (!event->rect().intersects(rect)) {
+      continue;
+    }
+
+    // Squares whose row and column are both even or both uneven are brown, the others beige
+    CellColors::eCellColors color = (coordinate.first + coordinate.second) % 2 == 0 ? CellColors::eBrown : CellColors::eBeige;
+    painter.drawPixmap(rect.topLeft(), _squareTiles[color][_highlighted[square] ? 1 : 0]);
+
+    // A legal target under the piece being dragged is framed
+    if (_dragging && coordinate == _hovered && isLegalTarget(coordinate)) {
+      painter.setPen(QPen(_squareColors[CellColors::eBeige][1], 3));
+      painter.drawRect(rect.adjusted(1, 1, -2, -2));
+    }
+
+    // The squares of the premoves queued are framed by a dashed line
+    if (_premoveSquares & BitBoards::squareBit(squareType(square))) {
+      painter.setPen(QPen(_squareColors[CellColors::eBrown][1], 3, Qt::DashLine));
+      painter.drawRect(rect.adjusted(1, 1, -2, -2));
+    }
+
+    // The pieces that are sliding or being dragged are drawn on top of every square instead
+    const definedPieceType& piece = _position.pieceOn(squareType(square));
+    if (piece.first != Pieces::Identities::eNone && coordinate != _slideTo && !(_dragging && coordinate == _dragFrom)) {
+      drawPiece(painter, piece, rect);
+    }
+  }
+
+  if (_slideTo != boardCoordinateType(0, 0)) {
+    QRect rect = slideRect();
+    if (event->rect().intersects(rect)) {
+      drawPiece(painter, pieceAt(_slideTo), rect);
+    }
+  }
+
+  if (_dragging) {
+    QRect rect = dragRect();
+    if (event->rect().intersects(rect)) {
+      drawPiece(painter, pieceAt(_dragFrom), rect);
+    }
+  }
+}
+
+void BoardView::drawPiece(QPainter& painter, const definedPieceType& piece, const QRect& rect) const
+{
+  const QPixmap& pixmap = _piecePixmaps[piece.second][piece.first];
+  int pixmapWidth = qRound(pixmap.width() / pixmap.devicePixelRatio());
+  int pixmapHeight = qRound(pixmap.height() / pixmap.devicePixelRatio());
+  painter.drawPixmap(rect.x() + (rect.width() - pixmapWidth) / 2,
+                     rect.y() + (rect.height() - pixmapHeight) / 2,
+                     pixmap);
+}
+
+void BoardView::mousePressEvent(QMouseEvent* event)
+{
+  // A right click calls off the premoves queued
+  if (event->button() == Qt::RightButton) {
+    emit premovesCancelled();
+    return;
+  }
+
+  if (event->button() != Qt::LeftButton) {
+    QWidget::mousePressEvent(event);
+    return;
+  }
+
+  boardCoordinateType coordinate = squareAt(event->pos());
+  if (coordinate == boardCoordinateType(0, 0)) {
+    return;
+  }
+
+  // Pressing the piece selected may start dragging it, so it is only let go of once the button is released
+  _deselectOnRelease = coordinate == _selection;
+  if (!_deselectOnRelease) {
+    clickSquare(coordinate);
+  }
+
+  // Whatever is selected now may be dragged to one of its legal targets
+  if (_selection == coordinate) {
+    _dragFrom = coordinate;
+    _pressPosition = event->pos();
+  }
+  else {
+    _dragFrom = boardCoordinateType(0, 0);
+  }
+}
+
+void BoardView::mouseMoveEvent(QMouseEvent* event)
+{
+  if (_dragFrom == boardCoordinateType(0, 0) || !(event->buttons() & Qt::LeftButton)) {
+    QWidget::mouseMoveEvent(event);
+    return;
+  }
+
+  if (!_dragging) {
+    if ((event->pos() - _pressPosition).manhattanLength() < QApplication::startDragDistance()) {
+      return;
+    }
+    _dragging = true;
+    _deselectOnRelease = false;
+    _dragPosition = event->pos();
+    update(squareRect(_dragFrom));
+  }
+
+  // Only the areas the piece left and entered, and the squares hovered, are repainted
+  QRect before = dragRect();
+  _dragPosition = event->pos();
+  update(before.united(dragRect()));
+
+  boardCoordinateType hovered = squareAt(event->pos());
+  if (hovered != _hovered) {
+    if (_hovered != boardCoordinateType(0, 0)) {
+      update(squareRect(_hovered));
+    }
+    if (hovered != boardCoordinateType(0, 0)) {
+      update(squareRect(hovered));
+    }
+    _hovered = hovered;
+  }
+}
+
+void BoardView::mouseReleaseEvent(QMouseEvent* event)
+{
+  if (event->button() != Qt::LeftButton) {
+    QWidget::mouseReleaseEvent(event);
+    return;
+  }
+
+  boardCoordinateType from = _dragFrom;
+  bool dragged = _dragging;
+
+  if (dragged) {
+    update(dragRect());
+    update(squareRect(from));
+    if (_hovered != boardCoordinateType(0, 0)) {
+      update(squareRect(_hovered));
+    }
+  }
+
+  _dragFrom = boardCoordinateType(0, 0);
+  _dragging = false;
+  _hovered = boardCoordinateType(0, 0);
+
+  if (dragged) {
+    // Dropped on a legal target the move is made, anywhere else the piece goes back and stays selected
+    boardCoordinateType target = squareAt(event->pos());
+    if (target != boardCoordinateType(0, 0) && _selection == from && isLegalTarget(target)) {
+      _dropping = true;
+      clickSquare(target);
+      _dropping = false;
+    }
+  }
+  else if (_deselectOnRelease) {
+    clickSquare(from);
+  }
+
+  _deselectOnRelease = false;
+}
+
+void BoardView::resizeEvent(QResizeEvent* event)
+{
+  QWidget::resizeEvent(event);
+
+  int squareSize = qMin(width(), height()) / 8;
+  _origin = QPoint((width() - 8 * squareSize) / 2, (height() - 8 * squareSize) / 2);
+
+  if (squareSize != _squareSize) {
+    _squareSize = squareSize;
+    renderSquareTiles();
+
+    // Pieces take up three quarters of their square, and are only scaled again once they reach another bucket
+    if (PiecePixmapCache::sizeBucket(_squareSize * 3 / 4) != _pieceSize) {
+      scalePiecePixmaps();
+    }
+  }
+}
+
+void BoardView::renderSquareTiles()
+{
+  _pixelRatio = PiecePixmapCache::devicePixelRatio(this);
+
+  // Drawn in physical pixels, so that the borders stay one pixel wide and sharp on high-DPI screens
+  int tileSize = qMax(1, qRound(_squareSize * _pixelRatio));
+
+  // Every square has a border in the opposite colour, of the same shade
+  for (int color = CellColors::eInit; color <= CellColors::eMax; ++color) {
+    int borderColor = color == CellColors::eBrown ? CellColors::eBeige : CellColors::eBrown;
+
+    for (int shade = 0; shade < 2; ++shade) {
+      QPixmap tile(tileSize, tileSize);
+      QPainter painter(&tile);
+      painter.fillRect(tile.rect(), _squareColors[color][shade]);
+      painter.setPen(_squareColors[borderColor][shade]);
+      painter.drawRect(tile.rect().adjusted(0, 0, -1, -1));
+      painter.end();
+
+      tile.setDevicePixelRatio(_pixelRatio);
+      _squareTiles[color][shade] = tile;
+    }
+  }
+}
+
+void BoardView::scalePiecePixmaps()
+{
+  _pieceSize = PiecePixmapCache::sizeBucket(_squareSize * 3 / 4);
+
+  for (int color = PieceColors::eBlack; color <= PieceColors::eMax; ++color) {
+    for (int identity = Pieces::Identities::ePawn; identity <= Pieces::Identities::eMax; ++identity) {
+      definedPieceType piece(static_cast<Pieces::Identities::eIdentities>(identity), static_cast<PieceColors::ePieceColors>(color));
+      _piecePixmaps[color][identity] = PiecePixmapCache::getInstance().pixmap(piece, _pieceSize, _pixelRatio);
+    }
+  }
+}
@@ -0,0 +1,446 @@
+///
+/// \file   BoardView.h
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This file contains the inner class and member definitions of the BoardView class.
+///
+
+#ifndef BOARDVIEW_H
+#define BOARDVIEW_H
+
+#include "CommonTypeDefinitions.h"
+#include "GameState.h"
+
+#include <QColor>
+#include <QPixmap>
+#include <QVariant>
+#include <QWidget>
+
+class QMouseEvent;
+class QPainter;
+class QPaintEvent;
+class QResizeEvent;
+class QVariantAnimation;
+
+///
+/// The BoardView class shows the squares of a Chess Board, the pieces on them, and the squares highlighted.
+///
+/// The whole Board is a single widget, painted in one paintEvent from pixmaps that are made once per size
+/// of the squares, rather than 64 buttons each styled by a stylesheet.  Each square is one of four tiles,
+/// brown or beige, highlighted or not, so changing a highlight costs no more than drawing another tile.  The view finds the square under
+/// the mouse itself, and turns two clicks into a move, emitting the same signals the Board used to get
+/// from its Cells:
+///
+/// * the first click, on a piece of the Player whose turn it is, selects it and emits startingANewMove,
+/// * the next click on another square emits completingMove,
+/// * clicking the piece selected again, or another piece of the same Player, emits nothingToDo, and in the
+///   latter case selects that piece instead.
+///
+/// While the AI is thinking, the same two clicks on the pieces of the human Player emit premoveQueued
+/// instead, for the Board to play the move once the AI has replied, and a right click emits
+/// premovesCancelled.  The squares of the premoves queued are framed, see setPremoves().  A premove starts
+/// from where the premoves queued before it leave the pieces, so a piece may be moved on again, and it may
+/// end on a square of the human Player too, to take back a piece the AI may capture there.  Only clicking
+/// the piece selected again calls such a move off.  A pawn premoved onto the last row becomes a Queen, a
+/// Knight if Ctrl is held down on the second click, a Castle with Shift, or a Bishop with Alt, see premovePromotion().
+///
+/// A piece selected may also be dragged, and dropped on one of its legal targets to complete the move, or
+/// anywhere else to put it back.  The legal targets are handed to the view as a bit board when the piece is
+/// selected, see setLegalTargets(), so telling whether the square under the mouse is one of them is a
+/// single test of a bit, however often the mouse moves.
+///
+/// Row 1 is drawn at the top, column 1 on the left, as with the Cells before.
+///
+/// A move made may be shown sliding from the square it left to the square it reached.  The slide is a
+/// QVariantAnimation, driven by the event loop at the refresh rate of the display, that repaints no more
+/// than the squares the piece passes over.  Nothing waits for it to finish, and the position shown is
+/// already the one after the move; only the piece that moved is drawn elsewhere while it slides.
+///
+class BoardView : public QWidget
+{
+  Q_OBJECT
+
+public:
+
+  ///
+  /// BoardView is the constructor for objects of the BoardView class.
+  ///
+  /// \param parent [in] is the widget the view is shown in, the Board.
+  ///
+  explicit BoardView(QWidget* parent = 0);
+
+  ///
+  /// ~BoardView is the default destructor for objects of type BoardView.
+  ///
+  virtual ~BoardView();
+
+  ///
+  /// setPosition shows the pieces of a state, in place of those shown up to now.
+  ///
+  /// Only the squares whose piece differs from the state shown before are repainted.
+  ///
+  /// \param position [in] is the state to show.
+  ///
+  void setPosition(const boardStateMapType& position);
+
+  ///
+  /// pieceAt returns the piece shown on a square.
+  ///
+  /// \param coordinate [in] is the square, as (row,column).
+  /// \return the piece, with identity and colour eNone if the square is empty.
+  ///
+  definedPieceType pieceAt(boardCoordinateType coordinate) const;
+
+  ///
+  /// setHighlighted changes the colour of a square between highlighted and regular.
+  ///
+  /// \param coordinate [in] is the square, as (row,column).
+  /// \param highLight [in] indicates whether to highlight the square or not.
+  ///
+  void setHighlighted(boardCoordinateType coordinate, bool highLight);
+
+  ///
+  /// clearHighlights shows every square in its regular colour.
+  ///
+  void clearHighlights();
+
+  ///
+  /// clearSelection forgets the piece selected by a first click, if any, and its legal targets.
+  ///
+  void clearSelection();
+
+  ///
+  /// setLegalTargets hands the view the squares the piece selected may move to, for it to be dragged to.
+  ///
+  /// \param targets [in] is the bit board of the squares, indexed by BitBoards::square().  It is forgotten along with the selection.
+  ///
+  void setLegalTargets(bitBoardType targets);
+
+  ///
+  /// isLegalTarget determines whether the piece selected may move to a square.
+  ///
+  /// \param coordinate [in] is the square, as (row,column).
+  /// \return true if the square is one of the legal targets.
+  ///
+  bool isLegalTarget(boardCoordinateType coordinate) const;
+
+  ///
+  /// selection returns the square selected by a first click.
+  ///
+  /// \return the square, as (row,column), or (0,0) if nothing is selected.
+  ///
+  boardCoordinateType selection() const;
+
+  ///
+  /// setPremoves frames the squares the premoves queued move from and to, and keeps the premoves for the next to start from.
+  ///
+  /// \param premoves [in] is the premoves queued, in the order they are to be played.
+  ///
+  void setPremoves(const boardMovesType& premoves);
+
+  ///
+  /// clickSquare handles a click on a square, as described for the class.
+  ///
+  /// \param coordinate [in] is the square clicked, as (row,column).
+  ///
+  void clickSquare(boardCoordinateType coordinate);
+
+  ///
+  /// slidePiece shows the piece on a square sliding there from another square.
+  ///
+  /// The position with the piece on its new square has to be shown first, see setPosition().  A slide
+  /// still going on is finished at once, and a piece just dropped by dragging is not slid.
+  ///
+  /// \param from [in] is the square the piece moved from, as (row,column).
+  /// \param to [in] is the square the piece moved to, as (row,column).
+  ///
+  void slidePiece(boardCoordinateType from, boardCoordinateType to);
+
+  ///
+  /// squareAt finds the square under a point of the view.
+  ///
+  /// \param point [in] is the point, in the coordinates of the view.
+  /// \return the square, as (row,column), or (0,0) if the point is not on the Board.
+  ///
+  boardCoordinateType squareAt(const QPoint& point) const;
+
+  ///
+  /// squareRect returns the area of the view a square is drawn in.
+  ///
+  /// \param coordinate [in] is the square, as (row,column).
+  /// \return the area of the square.
+  ///
+  QRect squareRect(boardCoordinateType coordinate) const;
+
+signals:
+
+  ///
+  /// startingANewMove lets the Board know a new move is being made.
+  ///
+  /// \param positionFrom is the square the piece moves from.
+  ///
+  void startingANewMove(boardCoordinateType positionFrom);
+
+  ///
+  /// completingMove lets the Board know a move is being completed.
+  ///
+  /// \param positionTo is the square the piece moves to.
+  ///
+  void completingMove(boardCoordinateType positionTo);
+
+  ///
+  /// nothingToDo lets the Board clear its highlights when a move is called off.
+  ///
+  void nothingToDo();
+
+  ///
+  /// premoveQueued lets the Board know a move is to be played as soon as the AI has replied.
+  ///
+  /// \param premove is the square the piece moves from (first), the square it moves to (second) and the promotion.
+  ///
+  void premoveQueued(boardMoveType premove);
+
+  ///
+  /// premovesCancelled lets the Board know the premoves queued are called off.
+  ///
+  void premovesCancelled();
+
+protected slots:
+
+  ///
+  /// advanceSlide moves the sliding piece on, repainting where it was and where it is now.
+  ///
+  /// \param progress [in] is how far the piece has slid, from 0.0 on the square it left to 1.0 on the square it reached.
+  ///
+  void advanceSlide(const QVariant& progress);
+
+  ///
+  /// finishSlide draws the piece that slid on its square again.
+  ///
+  void finishSlide();
+
+protected:
+
+  ///
+  /// paintEvent draws the squares, highlights and pieces that lie in the area to be painted.
+  ///
+  /// \param event [in] holds the area to be painted.
+  ///
+  virtual void paintEvent(QPaintEvent* event);
+
+  ///
+  /// mousePressEvent clicks the square under the mouse, and readies the piece selected to be dragged.
+  ///
+  /// \param event [in] holds the position of the mouse.
+  ///
+  virtual void mousePressEvent(QMouseEvent* event);
+
+  ///
+  /// mouseMoveEvent drags the piece selected along with the mouse, framing the legal target under it.
+  ///
+  /// \param event [in] holds the position of the mouse.
+  ///
+  virtual void mouseMoveEvent(QMouseEvent* event);
+
+  ///
+  /// mouseReleaseEvent drops the piece dragged, completing the move if it is dropped on a legal target.
+  ///
+  /// \param event [in] holds the position of the mouse.
+  ///
+  virtual void mouseReleaseEvent(QMouseEvent* event);
+
+  ///
+  /// resizeEvent fits the squares to the new size, and fetches the images of the pieces for them if their size bucket changed.
+  ///
+  /// \param event [in] holds the new size.
+  ///
+  virtual void resizeEvent(QResizeEvent* event);
+
+private:
+
+  ///
+  /// The eConstants enum houses the sizes the view works with.
+  ///
+  enum eConstants {
+    eSquares       = 64, ///< enum value eSquares is the number of squares on the Board.
+    eSlideDuration = 180 ///< enum value eSlideDuration is the time a piece takes to slide, in milliseconds.
+  };
+
+  ///
+  /// premovedPieces returns the squares the pieces of a colour stand on once the premoves queued are played.
+  ///
+  /// \param color [in] is the colour of the pieces.
+  /// \return the bit board of the squares, indexed by BitBoards::square().
+  ///
+  bitBoardType premovedPieces(PieceColors::ePieceColors color) const;
+
+  ///
+  /// premovePromotion names the piece a premove promotes to, from the keys held down as it is completed.
+  ///
+  /// \param from [in] is the square the piece is premoved from, where the premoves queued before leave it.
+  /// \param to [in] is the square the piece is premoved to.
+  /// \return the identity the pawn becomes, or Pieces::Identities::eNone if the premove does not promote.
+  ///
+  Pieces::Identities::eIdentities premovePromotion(boardCoordinateType from, boardCoordinateType to) const;
+
+  ///
+  /// dragRect returns the area the piece being dragged is drawn in.
+  ///
+  /// \return the area, the size of a square centred on the mouse.
+  ///
+  QRect dragRect() const;
+
+  ///
+  /// stopSlide finishes a slide still going on at once.
+  ///
+  void stopSlide();
+
+  ///
+  /// slideRect returns the area the sliding piece is drawn in.
+  ///
+  /// \return the area, the size of a square.
+  ///
+  QRect slideRect() const;
+
+  ///
+  /// drawPiece draws the image of a piece in the middle of an area.
+  ///
+  /// \param painter [in,out] is the painter to draw with.
+  /// \param piece [in] is the identity and colour of the piece.
+  /// \param rect [in] is the area, the size of a square.
+  ///
+  void drawPiece(QPainter& painter, const definedPieceType& piece, const QRect& rect) const;
+
+  ///
+  /// renderSquareTiles draws the four styles of a square at the size of the squares, in the physical pixels of the screen.
+  ///
+  void renderSquareTiles();
+
+  ///
+  /// scalePiecePixmaps fetches the image of every piece at the size of the squares from the PiecePixmapCache.
+  ///
+  void scalePiecePixmaps();
+
+  ///
+  /// _position is the private member that holds the state shown.
+  ///
+  boardStateMapType _position;
+
+  ///
+  /// _highlighted is the private member that holds whether every square is highlighted, indexed by BitBoards::square().
+  ///
+  bool _highlighted[eSquares];
+
+  ///
+  /// _selection is the private member that holds the square selected by a first click, (0,0) if there is none.
+  ///
+  boardCoordinateType _selection;
+
+  ///
+  /// _slide is the private member that animates the sliding piece.
+  ///
+  QVariantAnimation* _slide;
+
+  ///
+  /// _slideFrom is the private member that holds the square the sliding piece left, (0,0) if no piece is sliding.
+  ///
+  boardCoordinateType _slideFrom;
+
+  ///
+  /// _slideTo is the private member that holds the square the sliding piece reached, (0,0) if no piece is sliding.
+  ///
+  boardCoordinateType _slideTo;
+
+  ///
+  /// _slideProgress is the private member that holds how far the piece has slid, from 0.0 to 1.0.
+  ///
+  qreal _slideProgress;
+
+  ///
+  /// _legalTargets is the private member that holds the squares the piece selected may move to.
+  ///
+  bitBoardType _legalTargets;
+
+  ///
+  /// _dragFrom is the private member that holds the square of the piece that may be dragged, (0,0) if there is none.
+  ///
+  boardCoordinateType _dragFrom;
+
+  ///
+  /// _pressPosition is the private member that holds where the mouse was pressed, to tell a drag from a click.
+  ///
+  QPoint _pressPosition;
+
+  ///
+  /// _dragPosition is the private member that holds where the piece being dragged is, in the coordinates of the view.
+  ///
+  QPoint _dragPosition;
+
+  ///
+  /// _dragging is the private member that indicates whether a piece is being dragged.
+  ///
+  bool _dragging;
+
+  ///
+  /// _deselectOnRelease is the private member that indicates whether the piece selected was pressed, and is to be let go of if it is not dragged.
+  ///
+  bool _deselectOnRelease;
+
+  ///
+  /// _dropping is the private member that indicates whether a piece dragged is being dropped, so the move made is not slid as well.
+  ///
+  bool _dropping;
+
+  ///
+  /// _hovered is the private member that holds the square under the piece being dragged, (0,0) if there is none.
+  ///
+  boardCoordinateType _hovered;
+
+  ///
+  /// _premoveSquares is the private member that holds the squares the premoves queued move from and to.
+  ///
+  bitBoardType _premoveSquares;
+
+  ///
+  /// _premoves is the private member that holds the premoves queued, in the order they are to be played.
+  ///
+  boardMovesType _premoves;
+
+  ///
+  /// _squareSize is the private member that holds the width and height of a square, in pixels.
+  ///
+  int _squareSize;
+
+  ///
+  /// _pieceSize is the private member that holds the size the images of the pieces are scaled to, a bucket of the PiecePixmapCache.
+  ///
+  int _pieceSize;
+
+  ///
+  /// _pixelRatio is the private member that holds the device pixel ratio the tiles and images of the pieces were made for.
+  ///
+  qreal _pixelRatio;
+
+  ///
+  /// _origin is the private member that holds the top left corner of the Board within the view.
+  ///
+  QPoint _origin;
+
+  ///
+  /// _squareColors is the private member that holds the colours of the squares, per colour, regular (0) and highlighted (1).
+  ///
+  QColor _squareColors[CellColors::eMax + 1][2];
+
+  ///
+  /// _squareTiles is the private member that holds the squares drawn in every style, indexed as _squareColors.
+  ///
+  QPixmap _squareTiles[CellColors::eMax + 1][2];
+
+  ///
+  /// _piecePixmaps is the private member that holds the images of the pieces scaled to the squares, per colour and identity.
+  ///
+  QPixmap _piecePixmaps[PieceColors::eMax + 1][Pieces::Identities::eMax + 1];
+};
+
+#endif // BOARDVIEW_H
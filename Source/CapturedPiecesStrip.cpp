@@ -0,0 +1,102 @@
+///
+/// \file   CapturedPiecesStrip.cpp
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This file contains the inner management features of the CapturedPiecesStrip class.
+///
+
+#include "CapturedPiecesStrip.h"
+#include "PiecePixmapCache.h"
+
+#include <QPainter>
+#include <QPaintEvent>
+
+CapturedPiecesStrip::CapturedPiecesStrip(PieceColors::ePieceColors color, QWidget* parent) :
+  QWidget(parent),
+  _color(color)
+{
+
+}
+
+CapturedPiecesStrip::~CapturedPiecesStrip()
+{
+
+}
+
+void CapturedPiecesStrip::setCapturedPieces(const piecesListType& capturedPieces)
+{
+  // Find how many of the pieces shown are still the first ones captured of this colour
+  int kept = 0;
+  int captured = 0;
+  piecesListType::const_iterator i;
+  for (i = capturedPieces.constBegin(); i != capturedPieces.constEnd(); ++i) {
+    if ((*i).second != _color) {
+      continue;
+    }
+    if (kept == captured && kept < _pieces.size() && _pieces.at(kept) == *i) {
+      ++kept;
+    }
+    ++captured;
+  }
+
+  int shown = _pieces.size();
+  if (kept == shown && captured == shown) {
+    return;
+  }
+
+  // Drop what no longer matches, and append what was captured since
+  _pieces.erase(_pieces.begin() + kept, _pieces.end());
+
+  int index = 0;
+  for (i = capturedPieces.constBegin(); i != capturedPieces.constEnd(); ++i) {
+    if ((*i).second != _color) {
+      continue;
+    }
+    if (index >= kept) {
+      _pieces.append(*i);
+    }
+    ++index;
+  }
+
+  if (_pieces.size() != shown) {
+    setMinimumHeight(ePlaceSize * _pieces.size());
+    updateGeometry();
+  }
+
+  for (index = kept; index < qMax(shown, _pieces.size()); ++index) {
+    update(placeRect(index));
+  }
+}
+
+QSize CapturedPiecesStrip::sizeHint() const
+{
+  return QSize(ePlaceSize, ePlaceSize * _pieces.size());
+}
+
+void CapturedPiecesStrip::paintEvent(QPaintEvent* event)
+{
+  QPainter painter(this);
+  PiecePixmapCache& cache = PiecePixmapCache::getInstance();
+  qreal pixelRatio = PiecePixmapCache::devicePixelRatio(this);
+
+  for (int index = 0; index < _pieces.size(); ++index) {
+    QRect rect = placeRect(index);
+
+    if (!event->rect().intersects(rect)) {
+      continue;
+    }
+
+    const QPixmap& pixmap = cache.pixmap(_pieces.at(index), ePieceSize, pixelRatio);
+    int pixmapWidth = qRound(pixmap.width() / pixmap.devicePixelRatio());
+    int pixmapHeight = qRound(pixmap.height() / pixmap.devicePixelRatio());
+    painter.drawPixmap(rect.x() + (rect.width() - pixmapWidth) / 2,
+                       rect.y() + (rect.height() - pixmapHeight) / 2,
+                       pixmap);
+  }
+}
+
+QRect CapturedPiecesStrip::placeRect(int index) const
+{
+  return QRect((width() - ePlaceSize) / 2, index * ePlaceSize, ePlaceSize, ePlaceSize);
+}
@@ -0,0 +1,98 @@
+///
+/// \file   CapturedPiecesStrip.h
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This file contains the inner class and member definitions of the CapturedPiecesStrip class.
+///
+
+#ifndef CAPTUREDPIECESSTRIP_H
+#define CAPTUREDPIECESSTRIP_H
+
+#include "CommonTypeDefinitions.h"
+
+#include <QWidget>
+
+class QPaintEvent;
+
+///
+/// The CapturedPiecesStrip class shows the captured pieces of one colour as a column of images.
+///
+/// The strip is painted, rather than made up of a widget per piece, and keeps the pieces it shows.  When
+/// told about the captured pieces, it compares them to those it shows, drops whatever no longer matches,
+/// e.g. after a move is taken back or a new game is started, and appends the pieces captured since.  Only
+/// the places that changed are repainted, so a capture costs the same whether it is the first or the
+/// fifteenth.
+///
+class CapturedPiecesStrip : public QWidget
+{
+  Q_OBJECT
+
+public:
+
+  ///
+  /// CapturedPiecesStrip is the constructor for objects of the CapturedPiecesStrip class.
+  ///
+  /// \param color [in] is the colour of the pieces shown, the pieces of the other colour are passed over.
+  /// \param parent [in] is the widget the strip is shown in.
+  ///
+  explicit CapturedPiecesStrip(PieceColors::ePieceColors color, QWidget* parent = 0);
+
+  ///
+  /// ~CapturedPiecesStrip is the default destructor for objects of type CapturedPiecesStrip.
+  ///
+  virtual ~CapturedPiecesStrip();
+
+  ///
+  /// setCapturedPieces brings the strip up to date with the pieces captured so far.
+  ///
+  /// \param capturedPieces [in] is every piece captured so far, of either colour, in the order they were captured.
+  ///
+  void setCapturedPieces(const piecesListType& capturedPieces);
+
+  ///
+  /// sizeHint returns the size needed to show every piece in the strip.
+  ///
+  /// \return the size, one place wide and a place high per piece.
+  ///
+  virtual QSize sizeHint() const;
+
+protected:
+
+  ///
+  /// paintEvent draws the pieces that lie in the area to be painted.
+  ///
+  /// \param event [in] holds the area to be painted.
+  ///
+  virtual void paintEvent(QPaintEvent* event);
+
+private:
+
+  ///
+  /// The eConstants enum houses the sizes the strip works with.
+  ///
+  enum eConstants {
+    ePlaceSize = 45, ///< enum value ePlaceSize is the width and height of the place of a piece, in pixels.
+    ePieceSize = 40  ///< enum value ePieceSize is the width and height of the image of a piece, in pixels.
+  };
+
+  ///
+  /// placeRect returns the area of the strip a piece is drawn in.
+  ///
+  /// \param index [in] is the position of the piece in the strip, from the top.
+  /// \return the area of the place.
+  ///
+  QRect placeRect(int index) const;
+
+  ///
+  /// _color is the private member that holds the colour of the pieces shown.
+  ///
+  PieceColors::ePieceColors _color;
+
+  ///
+  /// _pieces is the private member that holds the pieces shown, from the top.
+  ///
+  piecesListType _pieces;
+};
+
+#endif // CAPTUREDPIECESSTRIP_H
@@ -0,0 +1,34 @@
+///
+/// \file   CastlingRights.h
+/// \author agent (agent@local)
+/// \date   October 2026
+/// This file contains the inner structure definition for the castling rights of a game of Chess.
+///
+/// A Player may castle to a side as long as neither the King, nor the Castle on that side, has moved
+/// or been captured.  The rights are kept as a combination of flags, one per colour and side.
+///
+
+#ifndef CASTLINGRIGHTS
+#define CASTLINGRIGHTS
+
+///
+/// The CastlingRights struct houses an enumeration of the flags that make up the castling rights.
+///
+struct CastlingRights {
+
+  ///
+  /// The eCastlingRights enum houses the castling rights flags, to be combined with |.
+  ///
+  enum eCastlingRights {
+    eNone           = 0,     ///< enum value eNone means neither Player may castle.
+    eBlackKingSide  = 1,     ///< enum value eBlackKingSide means black may castle towards column 8.
+    eBlackQueenSide = 2,     ///< enum value eBlackQueenSide means black may castle towards column 1.
+    eWhiteKingSide  = 4,     ///< enum value eWhiteKingSide means white may castle towards column 8.
+    eWhiteQueenSide = 8,     ///< enum value eWhiteQueenSide means white may castle towards column 1.
+    eAll            = 15,    ///< enum value eAll means both Players may castle to both sides, as at the start of a game.
+    eInit           = eNone, ///< enum value eInit is useful to always initialize elements to a valid state.
+    eMax            = eAll   ///< enum value eMax implies it is the largest combination of flags.
+  };
+};
+
+#endif // CASTLINGRIGHTS
@@ -17,15 +17,23 @@
 #include "UserIdentity.h"
 #include "Board.h"
 #include "MoveMapper.h"
+#include "AllocationTracker.h"
+#include "TurnTracer.h"
 
 #include <QMessageBox>
+#include <QInputDialog>
+#include <QClipboard>
+#include <QLayout>
 
 Chess::Chess(QWidget* parent) :
   QMainWindow(parent),
   ui(new Ui::Chess),
   _humanPlayer(new Player(UserIdentity::eHuman, PieceColors::eWhite)),
   _aiPlayer(new Player(UserIdentity::eComputer, PieceColors::eBlack)),
-  _artificialIntelligence(new MoveGenerator())
+  _artificialIntelligence(new MoveGenerator()),
+  _allocationOverlay(0),
+  _startingFullmoveNumber(1),
+  _startingColorToMove(PieceColors::eWhite)
 {
   ui->setupUi(this);
 
@@ -45,17 +53,13 @@ Chess::Chess(QWidget* parent) :
   connect(&TurnManager::getInstance(), SIGNAL(turnChanged(QSharedPointer<Player>&, boardCoordinatesType&, bool)),
           _artificialIntelligence.data(), SLOT(handleTurnChange(QSharedPointer<Player>&, boardCoordinatesType&, bool)));
 
-  // Lets the AI know it has to complete its move
-  connect(ui->_theGameBoard, SIGNAL(aiMoveCompletionRequired()),
-          _artificialIntelligence.data(), SLOT(handleMoveCompletionRequired()));
-
   // Tells the UI to update the containers of captured pieces (visually).
   connect(ui->_theGameBoard, SIGNAL(updateCapturedPiecesSignal()),
           this, SLOT(updateCapturedPieces()));
 
   // Allows the game to end.
-  connect(&TurnManager::getInstance(), SIGNAL(endGame(bool)),
-          this, SLOT(endGame(bool)));
+  connect(&TurnManager::getInstance(), SIGNAL(endGame(EndGameConditions::eEndGameConditions)),
+          this, SLOT(endGame(EndGameConditions::eEndGameConditions)));
 
   /* --------- Setup Captured Pieces Display area --------- */
   _blackScrollArea = new QScrollArea(ui->_blackPiecesArea);
@@ -67,17 +71,11 @@ Chess::Chess(QWidget* parent) :
   _blackScrollArea->setWidgetResizable(true);
   _whiteScrollArea->setWidgetResizable(true);
 
-  _blackContainer = new QWidget(_blackScrollArea);
-  _whiteContainer = new QWidget(_whiteScrollArea);
-
-  _blackScrollArea->setWidget(_blackContainer);
-  _whiteScrollArea->setWidget(_whiteContainer);
+  _blackStrip = new CapturedPiecesStrip(PieceColors::eBlack, _blackScrollArea);
+  _whiteStrip = new CapturedPiecesStrip(PieceColors::eWhite, _whiteScrollArea);
 
-  _blackLayout = new QVBoxLayout(_blackContainer);
-  _blackContainer->setLayout(_blackLayout);
-
-  _whiteLayout = new QVBoxLayout(_whiteContainer);
-  _whiteContainer->setLayout(_whiteLayout);
+  _blackScrollArea->setWidget(_blackStrip);
+  _whiteScrollArea->setWidget(_whiteStrip);
 
   QLayout* lay = ui->_blackPiecesArea->layout();
   lay->addWidget(_blackScrollArea);
@@ -86,6 +84,17 @@ Chess::Chess(QWidget* parent) :
   lay->addWidget(_whiteScrollArea);
   /* ------------------------------------------------------ */
 
+#ifdef CHESS_TRACK_ALLOCATIONS
+  // Shows what each turn allocated on top of the Board.  Creating the tracker here ties its subsystems to the GUI thread.
+  _allocationOverlay = new QLabel(ui->_theGameBoard);
+  _allocationOverlay->setAttribute(Qt::WA_TransparentForMouseEvents);
+  _allocationOverlay->setStyleSheet(QString("background-color: rgba(0, 0, 0, 160); color: white; font-family: monospace; padding: 4px;"));
+  _allocationOverlay->move(4, 4);
+
+  connect(&AllocationTracker::getInstance(), SIGNAL(turnCompleted()),
+          this, SLOT(updateAllocationOverlay()));
+#endif
+
   // Assuming this is why the application was launched...
   startNewGame();
 }
@@ -100,6 +109,51 @@ void Chess::on_action_New_Game_triggered()
   startNewGame();
 }
 
+void Chess::on_action_Load_FEN_triggered()
+{
+  bool accepted = false;
+  QString fen = QInputDialog::getText(this, QString("Load FEN"), QString("Position in Forsyth-Edwards Notation:"),
+                                      QLineEdit::Normal, QString(), &accepted).trimmed();
+  if (!accepted || fen.isEmpty()) {
+    return;
+  }
+
+  GameState position;
+  PieceColors::ePieceColors colorToMove = PieceColors::eWhite;
+  int halfmoveClock = 0;
+  int fullmoveNumber = 1;
+
+  if (!position.readFen(fen.toLatin1().constData(), colorToMove, &halfmoveClock, &fullmoveNumber)) {
+    QMessageBox::warning(this, QString("Load FEN"), QString("The position could not be read."), QMessageBox::Ok);
+    return;
+  }
+
+  startNewGame();
+  ui->_theGameBoard->loadPosition(position, halfmoveClock);
+  _startingFullmoveNumber = fullmoveNumber;
+  _startingColorToMove = colorToMove;
+
+  // The loaded position may already be over, or have the AI to move
+  TurnManager::startTurn(colorToMove == _humanPlayer->associatedColor() ? _humanPlayer : _aiPlayer);
+}
+
+void Chess::on_action_Copy_FEN_triggered()
+{
+  char fen[GameState::eMaxFenLength];
+  const GameHistory& history = Board::gameHistory();
+
+  // The move number goes up after every move black made since the position the game started in
+  int movesMade = history.size() - 1;
+  int blackMovesMade = _startingColorToMove == PieceColors::eWhite ? movesMade / 2 : (movesMade + 1) / 2;
+
+  Board::workingBoardStateMap().writeFen(fen,
+                                         TurnManager::getInstance().currentPlayer()->associatedColor(),
+                                         history.halfmoveClock(),
+                                         _startingFullmoveNumber + blackMovesMade);
+
+  QApplication::clipboard()->setText(QString::fromLatin1(fen));
+}
+
 void Chess::on_actionE_xit_triggered()
 {
   QApplication::exit(0);
@@ -108,6 +162,8 @@ void Chess::on_actionE_xit_triggered()
 void Chess::startNewGame()
 {
   ui->_theGameBoard->resetBoard(false, false);
+  _startingFullmoveNumber = 1;
+  _startingColorToMove = PieceColors::eWhite;
   _humanPlayer.reset(new Player(UserIdentity::eHuman, PieceColors::eWhite));
   _aiPlayer.reset(new Player(UserIdentity::eComputer, PieceColors::eBlack));
   ui->_theGameBoard->setEnabled(true);
@@ -116,56 +172,58 @@ void Chess::startNewGame()
   TurnManager::getInstance().switchPlayers(_humanPlayer);
 }
 
-void Chess::endGame(bool checkMate)
+void Chess::endGame(EndGameConditions::eEndGameConditions reason)
 {
   ui->_theGameBoard->setEnabled(false);
-  if (checkMate) {
+  switch (reason) {
+  case EndGameConditions::eCheckMate            :
     QMessageBox::information(0, QString("Game Over"), QString("Check and mate!"), QMessageBox::Ok);
-  }
-  else {
+    break;
+  case EndGameConditions::eInsufficientMaterial :
+    QMessageBox::information(0, QString("Game Over"), QString("Neither side has enough pieces left to mate."), QMessageBox::Ok);
+    break;
+  case EndGameConditions::eThreefoldRepetition  :
+    QMessageBox::information(0, QString("Game Over"), QString("The same position came up three times, the game is drawn."), QMessageBox::Ok);
+    break;
+  case EndGameConditions::eFiftyMoveRule        :
+    QMessageBox::information(0, QString("Game Over"), QString("Fifty moves without a capture or a pawn move, the game is drawn."), QMessageBox::Ok);
+    break;
+  default                                       :
     QMessageBox::information(0, QString("Game Over"), QString("The game has gone stale."), QMessageBox::Ok);
+    break;
   }
 }
 
 void Chess::updateCapturedPieces()
 {
-  clearLayout(_blackLayout);
-  clearLayout(_whiteLayout);
-
-  piecesListType capturedPieces = ui->_theGameBoard->workingCapturedPieces();
-  piecesListType::iterator i = capturedPieces.begin();
-
-  while (i != capturedPieces.end()) {
-    definedPieceType x = *i;
-    ++i;
-
-    QPixmap pm;
-    QString colorString = PieceColors::getInstance().colorNames().at(x.second);
-    QString identityString = Pieces::getInstance().identityNames().at(x.first);
-    QString resPath = QString(":/Pieces/") + QString("Resources/") + colorString + QString("/") + identityString + QString(".png");
-    pm.load(resPath, "PNG");
-    CapturedPieceWidget* capturedPiece = new CapturedPieceWidget(pm);
-
-    switch (x.second) {
-    case PieceColors::eBlack: {
-      _blackLayout->addWidget(capturedPiece);
-      break;
-    }
-    case PieceColors::eWhite: {
-      _whiteLayout->addWidget(capturedPiece);
-      break;
-    }
-    }
-  }
+  TRACE_SCOPE("Chess::updateCapturedPieces");
+  TRACK_ALLOCATIONS(eCapturedPieces);
+
+  // Each strip only appends what was captured since, or drops what a new game took back
+  const piecesListType& capturedPieces = Board::workingCapturedPieces();
+  _blackStrip->setCapturedPieces(capturedPieces);
+  _whiteStrip->setCapturedPieces(capturedPieces);
 }
 
-void Chess::clearLayout(QLayout* layout)
+void Chess::updateAllocationOverlay()
 {
-  if (layout) {
-    while (layout->count() > 0) {
-      QLayoutItem* item = layout->takeAt(0);
-      delete item->widget();
-      delete item;
-    }
+  if (_allocationOverlay == 0) {
+    return;
   }
+
+  const AllocationTracker& tracker = AllocationTracker::getInstance();
+  QString text = QString("Turn %1: allocations (bytes)").arg(tracker.lastTurnNumber());
+
+  for (int subsystem = AllocationSubsystems::eInit; subsystem <= AllocationSubsystems::eMax; ++subsystem) {
+    AllocationSubsystems::eAllocationSubsystems which = AllocationSubsystems::eAllocationSubsystems(subsystem);
+    AllocationTracker::Counts counts = tracker.lastTurn(which);
+    text += QString("\n%1 %2 (%3)").arg(AllocationTracker::subsystemName(which), -18)
+                                    .arg(counts.allocations, 8)
+                                    .arg(counts.bytes, 10);
+  }
+
+  _allocationOverlay->setText(text);
+  _allocationOverlay->adjustSize();
+  _allocationOverlay->raise();
+  _allocationOverlay->show();
 }
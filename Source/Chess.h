@@ -10,11 +10,12 @@
 
 #include "Player.h"
 #include "MoveGenerator.h"
-#include "CapturedPieceWidget.h"
+#include "CapturedPiecesStrip.h"
+#include "EndGameConditions.h"
 
+#include <QLabel>
 #include <QMainWindow>
 #include <QScrollArea>
-#include <QVBoxLayout>
 #include <QWidget>
 
 namespace Ui
@@ -58,6 +59,20 @@ private slots:
   ///
   void on_action_New_Game_triggered();
 
+  ///
+  /// on_action_Load_FEN_triggered is the Ui-generated slot for the "Load FEN" menu option.
+  ///
+  /// Asks for a position in Forsyth-Edwards Notation, and plays on from it, e.g. to reproduce a position reported as slow.
+  ///
+  void on_action_Load_FEN_triggered();
+
+  ///
+  /// on_action_Copy_FEN_triggered is the Ui-generated slot for the "Copy FEN" menu option.
+  ///
+  /// Puts the position on the Board on the clipboard, in Forsyth-Edwards Notation.
+  ///
+  void on_action_Copy_FEN_triggered();
+
   ///
   /// on_actionE_xit_triggered is the Ui-generated slot for the "Exit" menu option.
   ///
@@ -76,19 +91,27 @@ private slots:
   ///
   /// endGame is the slot that concludes the game flow.
   ///
-  /// The game is always, and only ended when no more moves are possible
-  /// for the Player whose turn it is.  If a King was checked, it's checkmate,
-  /// if not, it's stalemate.
+  /// The game is ended when no more moves are possible for the Player whose
+  /// turn it is.  If a King was checked, it's checkmate, if not, it's stalemate.
+  /// It is also ended, as a draw, when neither Player can ever mate the other,
+  /// when a position occurs for the third time, or by the fifty-move rule.
   ///
-  /// \param checkMate indicates whether a King was checked when the game ended.
+  /// \param reason indicates the condition that ended the game.
   ///
-  void endGame(bool checkMate);
+  void endGame(EndGameConditions::eEndGameConditions reason);
 
   ///
-  /// updateCapturedPieces clears out the old captured pieces and repopulates from the working state.
+  /// updateCapturedPieces brings the captured pieces shown up to date with the working state.
   ///
   void updateCapturedPieces();
 
+  ///
+  /// updateAllocationOverlay shows what was allocated during the last turn, per subsystem, on top of the Board.
+  ///
+  /// The overlay only exists in builds that track allocations, see AllocationTracker.
+  ///
+  void updateAllocationOverlay();
+
 private:
   ///
   /// ui is a pointer private member to the Ui::Class instance (the GUI).
@@ -110,16 +133,6 @@ private:
   ///
   QScopedPointer<MoveGenerator> _artificialIntelligence;
 
-  ///
-  /// _blackPieces is a list that can hold CapturedPieceWidget instances, and is populated as black pieces are captured.
-  ///
-  QList<CapturedPieceWidget> _blackPieces;
-
-  ///
-  /// _whitePieces is a list that can hold CapturedPieceWidget instances, and is populated as white pieces are captured.
-  ///
-  QList<CapturedPieceWidget> _whitePieces;
-
   ///
   /// _blackScrollArea is the scroll area where capture black pieces are displayed.
   ///
@@ -131,31 +144,29 @@ private:
   QScrollArea* _whiteScrollArea;
 
   ///
-  /// _blackContainer is the main body widget of the _blackScrollArea.
+  /// _blackStrip is the main body widget of the _blackScrollArea, showing the black pieces captured.
   ///
-  QWidget* _blackContainer;
+  CapturedPiecesStrip* _blackStrip;
 
   ///
-  /// _whiteContainer is the main body widget of the _whiteScrollArea.
+  /// _whiteStrip is the main body widget of the _whiteScrollArea, showing the white pieces captured.
   ///
-  QWidget* _whiteContainer;
+  CapturedPiecesStrip* _whiteStrip;
 
   ///
-  /// _blackLayout is the layout used to arrange the black pieces.
+  /// _allocationOverlay is the label over the Board that shows the allocations of the last turn, zero unless allocations are tracked.
   ///
-  QVBoxLayout* _blackLayout;
+  QLabel* _allocationOverlay;
 
   ///
-  /// _whiteLayout is the layout used to arrange the white pieces.
+  /// _startingFullmoveNumber is the number of the move about to be played in the position the game started in, 1 unless loaded from FEN.
   ///
-  QVBoxLayout* _whiteLayout;
+  int _startingFullmoveNumber;
 
   ///
-  /// clearLayout is the function used for clearing out the old captured pieces.
-  ///
-  /// \param layout is the layout to be cleared of all items.
+  /// _startingColorToMove is the colour of the side to move in the position the game started in.
   ///
-  void clearLayout(QLayout* layout);
+  PieceColors::ePieceColors _startingColorToMove;
 };
 
 #endif // CHESS_H
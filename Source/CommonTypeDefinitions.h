@@ -11,14 +11,16 @@
 
 #include "Pieces.h"
 #include "Colors.h"
-#include "Direction.h"
-#include "Magnitude.h"
-#include "StyleComponents.h"
 
 #include <QPair>
 #include <QMap>
 #include <QSet>
 
+///
+/// Forward declaration of class GameState.
+///
+class GameState;
+
 ///
 /// Anonymous Namespace
 ///
@@ -45,54 +47,104 @@ namespace
   typedef QSet < boardCoordinateType > boardCoordinatesType;
 
   ///
-  /// definedPieceType combines the attributes of a piece into a single type.
+  /// squareType is the index (0 to 63) of a coordinate, counted row by row from (1,1), as used by bit boards.
   ///
-  typedef QPair < Pieces::Identities::eIdentities, PieceColors::ePieceColors > definedPieceType;
+  typedef int squareType;
 
   ///
-  /// boardStateMapType the state of a board is mapped as all the playable pieces and their locations.
+  /// bitBoardType is a set of squares in a single 64-bit word, bit n representing squareType n.
   ///
-  typedef QMap < boardCoordinateType, definedPieceType > boardStateMapType;
+  typedef quint64 bitBoardType;
 
   ///
-  /// boardStateMapIteratorType is an iterator type for QMap. Useful for reverse-iteration.
+  /// hashType is the 64-bit Zobrist key of a board state, equal for equal positions.
   ///
-  typedef QMapIterator < boardCoordinateType, definedPieceType > boardStateMapIteratorType;
+  typedef quint64 hashType;
+
+}
+
+///
+/// The BoardMove struct combines the coordinate a piece moves from (first) and the coordinate it moves to (second),
+/// along with the identity a pawn that reaches the last row is promoted to.
+///
+/// It is the QPair of coordinates a move has always been, so that it is used the same way, with the promotion added.
+/// Two moves are only equal if they promote to the same identity as well.
+///
+struct BoardMove : public QPair < boardCoordinateType, boardCoordinateType > {
 
   ///
-  /// piecesListType a list of pieces, used to document captured pieces.
+  /// BoardMove is the constructor for objects of the BoardMove struct, a move from (0,0) to (0,0), i.e. no move.
   ///
-  typedef QList < definedPieceType > piecesListType;
+  BoardMove() :
+    QPair < boardCoordinateType, boardCoordinateType >(),
+    promotion(Pieces::Identities::eNone)
+  {
 
+  }
+
+  ///
+  /// BoardMove is the constructor for objects of the BoardMove struct.
   ///
-  /// magnitudeType is a custom, limited numerical definition from 1 to 8.
+  /// \param from [in] is the coordinate the piece moves from.
+  /// \param to [in] is the coordinate the piece moves to.
+  /// \param promotionTo [in] is the identity a pawn reaching the last row is promoted to, eNone for any other move.
   ///
-  typedef Magnitude::eMagnitudes magnitudeType;
+  BoardMove(const boardCoordinateType& from,
+            const boardCoordinateType& to,
+            Pieces::Identities::eIdentities promotionTo = Pieces::Identities::eNone) :
+    QPair < boardCoordinateType, boardCoordinateType >(from, to),
+    promotion(promotionTo)
+  {
+
+  }
+
+  Pieces::Identities::eIdentities promotion; ///< promotion is the identity the pawn is promoted to, eNone unless the move promotes.
+};
 
+///
+/// operator == determines whether two moves are the same, promotion included.
+///
+inline bool operator == (const BoardMove& a, const BoardMove& b)
+{
+  return a.first == b.first && a.second == b.second && a.promotion == b.promotion;
+}
+
+///
+/// operator != determines whether two moves differ, promotion included.
+///
+inline bool operator != (const BoardMove& a, const BoardMove& b)
+{
+  return !(a == b);
+}
+
+namespace
+{
   ///
-  /// directionType is a custom directions defined type, based on wind directions.
+  /// boardMoveType combines the coordinate a piece moves from (first), the coordinate it moves to (second) and
+  /// the promotion, see BoardMove.
   ///
-  typedef QSet < Direction::eDirectionRules > directionType;
+  typedef BoardMove boardMoveType;
 
   ///
-  /// directionsType is a container type that houses elements of type directionType.
+  /// boardMovesType an ordered collection of boardMoveType values in a QList.
   ///
-  typedef QPair < directionType, directionType > directionsType;
+  typedef QList < boardMoveType > boardMovesType;
 
   ///
-  /// magnitudesType is a containertype that houses elements of type magnitudeType.
+  /// definedPieceType combines the attributes of a piece into a single type.
   ///
-  typedef QPair < magnitudeType, magnitudeType > magnitudesType;
+  typedef QPair < Pieces::Identities::eIdentities, PieceColors::ePieceColors > definedPieceType;
 
   ///
-  /// movementType is a defined type that equates to a physics vector, has direction and magnitude.
+  /// boardStateMapType the state of a board is mapped as all the playable pieces and their locations.
+  /// See GameState.h, which has to be included wherever the state is used.
   ///
-  typedef QPair < directionsType, magnitudesType > movementType;
+  typedef GameState boardStateMapType;
 
   ///
-  /// splitStyleMapType
+  /// piecesListType a list of pieces, used to document captured pieces.
   ///
-  typedef QMap<eStyleComponents, QString> splitStyleMapType;
+  typedef QList < definedPieceType > piecesListType;
 }
 
 #endif // COMMONTYPEDEFINITIONS
@@ -0,0 +1,38 @@
+///
+/// \file   EndGameConditions.h
+/// \author agent (agent@local)
+/// \date   October 2026
+/// This file contains the inner structure definition for the conditions under which a game of Chess ends.
+///
+/// A game ends when:
+/// * the Player whose turn it is has no legal move, and its King is checked (checkmate),
+/// * the Player whose turn it is has no legal move, and its King is not checked (stalemate),
+/// * neither Player has the pieces left to ever checkmate the other,
+/// * the same position occurs for the third time, with the same Player to move,
+/// * fifty moves of each Player go by without a capture or a Pawn move.
+///
+
+#ifndef ENDGAMECONDITIONS
+#define ENDGAMECONDITIONS
+
+///
+/// The EndGameConditions struct houses an enumeration of the reasons a game can end for.
+///
+struct EndGameConditions {
+
+  ///
+  /// The eEndGameConditions enum houses the reasons a game can end for.
+  ///
+  enum eEndGameConditions {
+    eNone                 = 0,                     ///< enum value eNone means the game has not ended.
+    eCheckMate,                                    ///< enum value eCheckMate means the side to move is checked, and cannot move.
+    eStaleMate,                                    ///< enum value eStaleMate means the side to move is not checked, but cannot move.
+    eInsufficientMaterial,                         ///< enum value eInsufficientMaterial means neither side can ever checkmate.
+    eThreefoldRepetition,                          ///< enum value eThreefoldRepetition means the position occurred three times.
+    eFiftyMoveRule,                                ///< enum value eFiftyMoveRule means a hundred halfmoves went by without a capture or Pawn move.
+    eInit                 = eNone,                 ///< enum value eInit is useful to always initialize elements to a valid state.
+    eMax                  = eFiftyMoveRule         ///< enum value eMax implies it is the last condition in the range.
+  };
+};
+
+#endif // ENDGAMECONDITIONS
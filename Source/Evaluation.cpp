@@ -0,0 +1,170 @@
+///
+/// \file   Evaluation.cpp
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This file contains the inner management features of the Evaluation class.
+///
+/// In this cpp file the square tables are laid out as white sees the board, row 1 (black's side) first,
+/// i.e. in square order.  Black looks its squares up mirrored, with the rows swapped.
+///
+
+#include "Evaluation.h"
+#include "GameState.h"
+#include "BitBoards.h"
+
+namespace
+{
+  const int pawnSquares[64] = {
+     0,  0,  0,  0,  0,  0,  0,  0,
+    50, 50, 50, 50, 50, 50, 50, 50,
+    10, 10, 20, 30, 30, 20, 10, 10,
+     5,  5, 10, 25, 25, 10,  5,  5,
+     0,  0,  0, 20, 20,  0,  0,  0,
+     5, -5,-10,  0,  0,-10, -5,  5,
+     5, 10, 10,-20,-20, 10, 10,  5,
+     0,  0,  0,  0,  0,  0,  0,  0
+  };
+
+  const int knightSquares[64] = {
+    -50,-40,-30,-30,-30,-30,-40,-50,
+    -40,-20,  0,  0,  0,  0,-20,-40,
+    -30,  0, 10, 15, 15, 10,  0,-30,
+    -30,  5, 15, 20, 20, 15,  5,-30,
+    -30,  0, 15, 20, 20, 15,  0,-30,
+    -30,  5, 10, 15, 15, 10,  5,-30,
+    -40,-20,  0,  5,  5,  0,-20,-40,
+    -50,-40,-30,-30,-30,-30,-40,-50
+  };
+
+  const int bishopSquares[64] = {
+    -20,-10,-10,-10,-10,-10,-10,-20,
+    -10,  0,  0,  0,  0,  0,  0,-10,
+    -10,  0,  5, 10, 10,  5,  0,-10,
+    -10,  5,  5, 10, 10,  5,  5,-10,
+    -10,  0, 10, 10, 10, 10,  0,-10,
+    -10, 10, 10, 10, 10, 10, 10,-10,
+    -10,  5,  0,  0,  0,  0,  5,-10,
+    -20,-10,-10,-10,-10,-10,-10,-20
+  };
+
+  const int castleSquares[64] = {
+     0,  0,  0,  0,  0,  0,  0,  0,
+     5, 10, 10, 10, 10, 10, 10,  5,
+    -5,  0,  0,  0,  0,  0,  0, -5,
+    -5,  0,  0,  0,  0,  0,  0, -5,
+    -5,  0,  0,  0,  0,  0,  0, -5,
+    -5,  0,  0,  0,  0,  0,  0, -5,
+    -5,  0,  0,  0,  0,  0,  0, -5,
+     0,  0,  0,  5,  5,  0,  0,  0
+  };
+
+  const int queenSquares[64] = {
+    -20,-10,-10, -5, -5,-10,-10,-20,
+    -10,  0,  0,  0,  0,  0,  0,-10,
+    -10,  0,  5,  5,  5,  5,  0,-10,
+     -5,  0,  5,  5,  5,  5,  0, -5,
+      0,  0,  5,  5,  5,  5,  0, -5,
+    -10,  5,  5,  5,  5,  5,  0,-10,
+    -10,  0,  5,  0,  0,  0,  0,-10,
+    -20,-10,-10, -5, -5,-10,-10,-20
+  };
+
+  const int kingSquares[64] = {
+    -30,-40,-40,-50,-50,-40,-40,-30,
+    -30,-40,-40,-50,-50,-40,-40,-30,
+    -30,-40,-40,-50,-50,-40,-40,-30,
+    -30,-40,-40,-50,-50,-40,-40,-30,
+    -20,-30,-30,-40,-40,-30,-30,-20,
+    -10,-20,-20,-20,-20,-20,-20,-10,
+     20, 20,  0,  0,  0,  0, 20, 20,
+     20, 30, 10,  0,  0, 10, 30, 20
+  };
+
+  ///
+  /// kingEndGameSquares is used instead of kingSquares once the Queens are gone, and the King had better join the fight.
+  ///
+  const int kingEndGameSquares[64] = {
+    -50,-40,-30,-20,-20,-30,-40,-50,
+    -30,-20,-10,  0,  0,-10,-20,-30,
+    -30,-10, 20, 30, 30, 20,-10,-30,
+    -30,-10, 30, 40, 40, 30,-10,-30,
+    -30,-10, 30, 40, 40, 30,-10,-30,
+    -30,-10, 20, 30, 30, 20,-10,-30,
+    -30,-30,  0,  0,  0,  0,-30,-30,
+    -50,-30,-30,-30,-30,-30,-30,-50
+  };
+
+  ///
+  /// eMirror swaps the rows of a square when exclusive-ored with it, so that black can use the tables of white.
+  ///
+  const squareType eMirror = 56;
+
+  int scoreOf(const boardStateMapType& state, PieceColors::ePieceColors color, bool endGame)
+  {
+    int score = 0;
+    squareType mirror = color == PieceColors::eWhite ? 0 : eMirror;
+
+    for (int identity = Pieces::Identities::ePawn; identity <= Pieces::Identities::eMax; ++identity) {
+      Pieces::Identities::eIdentities pieceIdentity = Pieces::Identities::eIdentities(identity);
+      bitBoardType pieces = state.pieces(color, pieceIdentity);
+      const int* squares = 0;
+
+      switch (pieceIdentity) {
+      case Pieces::Identities::ePawn   :
+        squares = pawnSquares;
+        break;
+      case Pieces::Identities::eKnight :
+        squares = knightSquares;
+        break;
+      case Pieces::Identities::eBishop :
+        squares = bishopSquares;
+        break;
+      case Pieces::Identities::eCastle :
+        squares = castleSquares;
+        break;
+      case Pieces::Identities::eQueen  :
+        squares = queenSquares;
+        break;
+      case Pieces::Identities::eKing   :
+        squares = endGame ? kingEndGameSquares : kingSquares;
+        break;
+      default                          :
+        break;
+      }
+
+      score += BitBoards::count(pieces) * Evaluation::pieceValue(pieceIdentity);
+      while (pieces) {
+        score += squares[BitBoards::popLowestSquare(pieces) ^ mirror];
+      }
+    }
+    return score;
+  }
+}
+
+int Evaluation::evaluate(const boardStateMapType& state, PieceColors::ePieceColors colorToMove)
+{
+  bool endGame = (state.pieces(PieceColors::eBlack, Pieces::Identities::eQueen) |
+                  state.pieces(PieceColors::eWhite, Pieces::Identities::eQueen)) == 0;
+
+  int score = scoreOf(state, PieceColors::eWhite, endGame) - scoreOf(state, PieceColors::eBlack, endGame);
+  return colorToMove == PieceColors::eWhite ? score : -score;
+}
+
+int Evaluation::pieceValue(Pieces::Identities::eIdentities identity)
+{
+  switch (identity) {
+  case Pieces::Identities::ePawn   :
+    return 100;
+  case Pieces::Identities::eKnight :
+    return 320;
+  case Pieces::Identities::eBishop :
+    return 330;
+  case Pieces::Identities::eCastle :
+    return 500;
+  case Pieces::Identities::eQueen  :
+    return 900;
+  default                          :
+    return 0;
+  }
+}
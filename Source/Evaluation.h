@@ -0,0 +1,56 @@
+///
+/// \file   Evaluation.h
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This file contains structure definitions and members of the Evaluation class.
+///
+
+#ifndef EVALUATION_H
+#define EVALUATION_H
+
+#include "CommonTypeDefinitions.h"
+
+///
+/// The Evaluation class scores a position statically, i.e. without looking at any moves.
+///
+/// The score is the material of both sides, in centipawns, plus a bonus or penalty per piece for the
+/// square it stands on: Knights and Bishops like the centre, Pawns like to advance, and the King likes to
+/// stay behind its Pawns until the Queens are gone.  It is the score a search falls back on at its leaves.
+///
+/// Example usage:
+/// \code
+///  int score = Evaluation::evaluate(state, PieceColors::eWhite); // > 0 if white is better
+/// \endcode
+///
+class Evaluation
+{
+
+public:
+
+  ///
+  /// evaluate scores a position from the point of view of the side to move.
+  ///
+  /// \param state [in] the position to score.
+  /// \param colorToMove [in] the colour of the side to move.
+  /// \return the score in centipawns, positive if the side to move is better.
+  ///
+  static int evaluate(const boardStateMapType& state, PieceColors::ePieceColors colorToMove);
+
+  ///
+  /// pieceValue gives the material value of a piece identity.
+  ///
+  /// \param identity [in] the identity of the piece.
+  /// \return the value of the piece in centipawns, 0 for the King.
+  ///
+  static int pieceValue(Pieces::Identities::eIdentities identity);
+
+private:
+
+  ///
+  /// Evaluation is the private default constructor, as there is nothing to construct.
+  ///
+  Evaluation();
+};
+
+#endif // EVALUATION_H
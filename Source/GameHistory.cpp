@@ -0,0 +1,107 @@
+///
+/// \file   GameHistory.cpp
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This file contains the inner management features of the GameHistory class.
+///
+/// In this cpp file repetitions are counted by walking back from the current position,
+/// two positions at a time, no further than the halfmove clock reaches.
+///
+
+#include "GameHistory.h"
+
+namespace
+{
+  ///
+  /// eFiftyMoves is the halfmove clock at which the fifty-move rule draws the game, fifty moves of each side.
+  ///
+  const int eFiftyMoves = 100;
+
+  ///
+  /// eExpectedPositions is the number of positions room is made for up front, enough for most games and searches.
+  ///
+  const int eExpectedPositions = 512;
+}
+
+GameHistory::GameHistory()
+{
+  _entries.reserve(eExpectedPositions);
+}
+
+GameHistory::~GameHistory()
+{
+
+}
+
+void GameHistory::reset(hashType startingHash, int halfmoveClock)
+{
+  _entries.clear();
+
+  Entry entry;
+  entry.hash = startingHash;
+  entry.halfmoveClock = halfmoveClock;
+  _entries.append(entry);
+}
+
+void GameHistory::push(hashType hash, bool irreversible)
+{
+  Entry entry;
+  entry.hash = hash;
+  entry.halfmoveClock = (irreversible || _entries.isEmpty()) ? 0 : _entries.last().halfmoveClock + 1;
+  _entries.append(entry);
+}
+
+void GameHistory::pop()
+{
+  if (!_entries.isEmpty()) {
+    _entries.removeLast();
+  }
+}
+
+int GameHistory::size() const
+{
+  return _entries.size();
+}
+
+int GameHistory::halfmoveClock() const
+{
+  return _entries.isEmpty() ? 0 : _entries.last().halfmoveClock;
+}
+
+int GameHistory::repetitions() const
+{
+  if (_entries.isEmpty()) {
+    return 0;
+  }
+
+  const Entry& current = _entries.last();
+  int newest = _entries.size() - 1;
+  int oldest = newest - current.halfmoveClock;
+  if (oldest < 0) {
+    oldest = 0;
+  }
+
+  int count = 0;
+  for (int index = newest - 2; index >= oldest; index -= 2) {
+    if (_entries.at(index).hash == current.hash) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+bool GameHistory::isRepetition() const
+{
+  return repetitions() >= 1;
+}
+
+bool GameHistory::isThreefoldRepetition() const
+{
+  return repetitions() >= 2;
+}
+
+bool GameHistory::isFiftyMoveDraw() const
+{
+  return halfmoveClock() >= eFiftyMoves;
+}
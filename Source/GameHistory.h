@@ -0,0 +1,130 @@
+///
+/// \file   GameHistory.h
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This file contains structure definitions and members of the GameHistory class.
+///
+
+#ifndef GAMEHISTORY_H
+#define GAMEHISTORY_H
+
+#include "CommonTypeDefinitions.h"
+
+#include <QVector>
+
+///
+/// The GameHistory class keeps the Zobrist key of every position reached in a game, and the halfmove clock.
+///
+/// The halfmove clock counts the moves made since the last capture or Pawn move.  Such a move can never be
+/// undone, so no position from before it can ever be repeated, and repetitions are only looked for among
+/// the positions after it.  Only every second position is compared, as those are the ones with the same
+/// side to move.
+///
+/// The game keeps one GameHistory, see Board::gameHistory(), to end the game on a threefold repetition or by
+/// the fifty-move rule.  A search may keep its own, pushing and popping as it plays moves out, and treat
+/// any repetition as a draw.
+///
+/// Example usage:
+/// \code
+///  GameHistory history;
+///  history.reset(state.hash());
+///  history.push(stateAfterTheMove.hash(), movedAPawn || capturedAPiece);
+///  if (history.isThreefoldRepetition() || history.isFiftyMoveDraw()) { ... }
+/// \endcode
+///
+class GameHistory
+{
+
+public:
+
+  ///
+  /// GameHistory is the default constructor for objects of the GameHistory class, creating an empty history.
+  ///
+  GameHistory();
+
+  ///
+  /// ~GameHistory is the default destructor for objects of type GameHistory.
+  ///
+  virtual ~GameHistory();
+
+  ///
+  /// reset forgets every position, and starts over from a single one.
+  ///
+  /// \param startingHash [in] the key of the position the game starts in.
+  /// \param halfmoveClock [in] the halfmove clock of that position, e.g. as read from a FEN string.
+  ///
+  void reset(hashType startingHash, int halfmoveClock = 0);
+
+  ///
+  /// push records the position reached by a move.
+  ///
+  /// \param hash [in] the key of the position after the move.
+  /// \param irreversible [in] indicates whether the move captured a piece or moved a Pawn, which resets the halfmove clock.
+  ///
+  void push(hashType hash, bool irreversible);
+
+  ///
+  /// pop forgets the last position recorded, restoring the halfmove clock to what it was before it.
+  ///
+  void pop();
+
+  ///
+  /// size gives the number of positions recorded.
+  ///
+  /// \return the number of positions, including the starting position.
+  ///
+  int size() const;
+
+  ///
+  /// halfmoveClock gives the number of moves made since the last capture or Pawn move.
+  ///
+  /// \return the halfmove clock of the current position.
+  ///
+  int halfmoveClock() const;
+
+  ///
+  /// repetitions counts how often the current position occurred before, with the same side to move.
+  ///
+  /// \return the number of earlier occurrences, since the last capture or Pawn move.
+  ///
+  int repetitions() const;
+
+  ///
+  /// isRepetition determines whether the current position occurred before, which a search may score as a draw.
+  ///
+  /// \return true if the position is repeated at least once.
+  ///
+  bool isRepetition() const;
+
+  ///
+  /// isThreefoldRepetition determines whether the current position occurred for the third time, which ends the game.
+  ///
+  /// \return true if the position occurred at least twice before.
+  ///
+  bool isThreefoldRepetition() const;
+
+  ///
+  /// isFiftyMoveDraw determines whether fifty moves of each side went by without a capture or a Pawn move.
+  ///
+  /// \return true if the halfmove clock reached one hundred.
+  ///
+  bool isFiftyMoveDraw() const;
+
+private:
+
+  ///
+  /// The Entry struct pairs the key of a position with the halfmove clock it was reached at.
+  ///
+  struct Entry {
+    hashType hash;     ///< hash is the Zobrist key of the position.
+    int halfmoveClock; ///< halfmoveClock is the number of moves since the last capture or Pawn move.
+  };
+
+  ///
+  /// _entries is the private member that stores every position of the game, the current one last.
+  ///
+  QVector<Entry> _entries;
+};
+
+#endif // GAMEHISTORY_H
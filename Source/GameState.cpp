@@ -0,0 +1,610 @@
+///
+/// \file   GameState.cpp
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This file contains the inner management features of the GameState class.
+///
+/// In this cpp file every change to the board funnels through place() and lift(), which keep the
+/// piece on each square, the bit board of each colour and identity, and the square of each king in step.
+///
+
+#include "GameState.h"
+
+namespace
+{
+  ///
+  /// evenSquares holds every square whose row and column add up to an even number, i.e. the cells of one colour.
+  ///
+  const bitBoardType evenSquares = Q_UINT64_C(0xAA55AA55AA55AA55);
+
+  ///
+  /// The eHomeSquares enum names the squares Kings and Castles start on, as far as castling is concerned.
+  ///
+  enum eHomeSquares {
+    eBlackQueenSideCastle = 0,  ///< enum value eBlackQueenSideCastle is the square (1,1).
+    eBlackKing            = 4,  ///< enum value eBlackKing is the square (1,5).
+    eBlackKingSideCastle  = 7,  ///< enum value eBlackKingSideCastle is the square (1,8).
+    eWhiteQueenSideCastle = 56, ///< enum value eWhiteQueenSideCastle is the square (8,1).
+    eWhiteKing            = 60, ///< enum value eWhiteKing is the square (8,5).
+    eWhiteKingSideCastle  = 63  ///< enum value eWhiteKingSideCastle is the square (8,8).
+  };
+
+  ///
+  /// fenLetters holds the FEN letter of each identity, in Pieces::Identities::eIdentities order, for black pieces.  White pieces are upper case.
+  ///
+  const char fenLetters[] = " prnbqk";
+
+  ///
+  /// identityOfFenLetter gives the identity of a FEN piece letter, regardless of its case, eNone if it is no piece letter.
+  ///
+  Pieces::Identities::eIdentities identityOfFenLetter(char letter)
+  {
+    char lowerCase = (letter >= 'A' && letter <= 'Z') ? char(letter - 'A' + 'a') : letter;
+
+    for (int identity = Pieces::Identities::ePawn; identity <= Pieces::Identities::eMax; ++identity) {
+      if (fenLetters[identity] == lowerCase) {
+        return Pieces::Identities::eIdentities(identity);
+      }
+    }
+    return Pieces::Identities::eNone;
+  }
+
+  ///
+  /// readNumber reads an unsigned decimal number, advancing past it.
+  ///
+  bool readNumber(const char*& text, int& number)
+  {
+    if (*text < '0' || *text > '9') {
+      return false;
+    }
+
+    number = 0;
+    while (*text >= '0' && *text <= '9') {
+      number = number * 10 + (*text++ - '0');
+    }
+    return true;
+  }
+
+  ///
+  /// writeNumber writes an unsigned decimal number, advancing past it.
+  ///
+  void writeNumber(char*& text, int number)
+  {
+    char digits[12];
+    int count = 0;
+
+    do {
+      digits[count++] = char('0' + number % 10);
+      number /= 10;
+    } while (number > 0 && count < 12);
+
+    while (count > 0) {
+      *text++ = digits[--count];
+    }
+  }
+
+  ///
+  /// castlingRightsLost gives the castling rights that are gone once a piece moves from, or is taken on, a square.
+  ///
+  int castlingRightsLost(squareType square)
+  {
+    switch (square) {
+    case eBlackQueenSideCastle :
+      return CastlingRights::eBlackQueenSide;
+    case eBlackKing            :
+      return CastlingRights::eBlackKingSide | CastlingRights::eBlackQueenSide;
+    case eBlackKingSideCastle  :
+      return CastlingRights::eBlackKingSide;
+    case eWhiteQueenSideCastle :
+      return CastlingRights::eWhiteQueenSide;
+    case eWhiteKing            :
+      return CastlingRights::eWhiteKingSide | CastlingRights::eWhiteQueenSide;
+    case eWhiteKingSideCastle  :
+      return CastlingRights::eWhiteKingSide;
+    default                    :
+      return CastlingRights::eNone;
+    }
+  }
+}
+
+const squareType GameState::eNoSquare;
+const int GameState::eMaxFenLength;
+
+GameState::GameState()
+{
+  clear();
+}
+
+definedPieceType GameState::value(const boardCoordinateType& coordinate, const definedPieceType& defaultValue) const
+{
+  if (!isOnTheBoard(coordinate)) {
+    return defaultValue;
+  }
+
+  const definedPieceType& piece = _board[BitBoards::square(coordinate)];
+  if (piece.first == Pieces::Identities::eNone) {
+    return defaultValue;
+  }
+  return piece;
+}
+
+void GameState::insert(const boardCoordinateType& coordinate, const definedPieceType& piece)
+{
+  if (!isOnTheBoard(coordinate)) {
+    return;
+  }
+
+  squareType square = BitBoards::square(coordinate);
+  if (_board[square].first != Pieces::Identities::eNone) {
+    lift(square); // replaces the piece already there, as QMap did
+  }
+
+  if (piece.first != Pieces::Identities::eNone) {
+    place(square, piece);
+  }
+}
+
+int GameState::remove(const boardCoordinateType& coordinate)
+{
+  if (!contains(coordinate)) {
+    return 0;
+  }
+
+  lift(BitBoards::square(coordinate));
+  return 1;
+}
+
+definedPieceType GameState::take(const boardCoordinateType& coordinate)
+{
+  if (!contains(coordinate)) {
+    return definedPieceType();
+  }
+
+  return lift(BitBoards::square(coordinate));
+}
+
+bool GameState::contains(const boardCoordinateType& coordinate) const
+{
+  return isOnTheBoard(coordinate) && _board[BitBoards::square(coordinate)].first != Pieces::Identities::eNone;
+}
+
+bool GameState::isEmpty() const
+{
+  return occupancy() == 0;
+}
+
+int GameState::size() const
+{
+  return BitBoards::count(occupancy());
+}
+
+void GameState::clear()
+{
+  for (squareType square = 0; square < 64; ++square) {
+    _board[square] = definedPieceType(Pieces::Identities::eNone, PieceColors::eNone);
+  }
+  _hash = 0;
+  _castlingRights = CastlingRights::eNone;
+  _enPassantSquare = eNoSquare;
+
+  for (int color = PieceColors::eInit; color <= PieceColors::eMax; ++color) {
+    _colors[color] = 0;
+    _kingSquares[color] = eNoSquare;
+
+    for (int identity = Pieces::Identities::eInit; identity <= Pieces::Identities::eMax; ++identity) {
+      _pieces[color][identity] = 0;
+    }
+  }
+}
+
+bool GameState::operator==(const GameState& other) const
+{
+  // Different keys always mean different boards, equal keys still have to be confirmed
+  if (_hash != other._hash ||
+      _castlingRights != other._castlingRights ||
+      _enPassantSquare != other._enPassantSquare) {
+    return false;
+  }
+
+  // Equal occupancy per colour and identity means an equal board, without looking at the squares one by one
+  for (int color = PieceColors::eBlack; color <= PieceColors::eMax; ++color) {
+    for (int identity = Pieces::Identities::ePawn; identity <= Pieces::Identities::eMax; ++identity) {
+      if (_pieces[color][identity] != other._pieces[color][identity]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool GameState::operator!=(const GameState& other) const
+{
+  return !(*this == other);
+}
+
+boardCoordinateType GameState::kingLocation(PieceColors::ePieceColors color) const
+{
+  squareType square = _kingSquares[color];
+  if (square == eNoSquare) {
+    return boardCoordinateType(0, 0);
+  }
+  return BitBoards::coordinate(square);
+}
+
+bitBoardType GameState::attackersTo(squareType square, bitBoardType occupied) const
+{
+  const BitBoards& bitBoards = BitBoards::getInstance();
+
+  bitBoardType castlesAndQueens = _pieces[PieceColors::eBlack][Pieces::Identities::eCastle] |
+                                  _pieces[PieceColors::eWhite][Pieces::Identities::eCastle] |
+                                  _pieces[PieceColors::eBlack][Pieces::Identities::eQueen]  |
+                                  _pieces[PieceColors::eWhite][Pieces::Identities::eQueen];
+
+  bitBoardType bishopsAndQueens = _pieces[PieceColors::eBlack][Pieces::Identities::eBishop] |
+                                  _pieces[PieceColors::eWhite][Pieces::Identities::eBishop] |
+                                  _pieces[PieceColors::eBlack][Pieces::Identities::eQueen]  |
+                                  _pieces[PieceColors::eWhite][Pieces::Identities::eQueen];
+
+  bitBoardType knights = _pieces[PieceColors::eBlack][Pieces::Identities::eKnight] |
+                         _pieces[PieceColors::eWhite][Pieces::Identities::eKnight];
+
+  bitBoardType kings = _pieces[PieceColors::eBlack][Pieces::Identities::eKing] |
+                       _pieces[PieceColors::eWhite][Pieces::Identities::eKing];
+
+  // A black pawn attacks the square if a white pawn on the square would attack the black pawn, and vice versa
+  return (bitBoards.pawnAttacks(PieceColors::eWhite, square) & _pieces[PieceColors::eBlack][Pieces::Identities::ePawn]) |
+         (bitBoards.pawnAttacks(PieceColors::eBlack, square) & _pieces[PieceColors::eWhite][Pieces::Identities::ePawn]) |
+         (bitBoards.knightAttacks(square) & knights) |
+         (bitBoards.kingAttacks(square) & kings) |
+         (bitBoards.castleAttacks(square, occupied) & castlesAndQueens) |
+         (bitBoards.bishopAttacks(square, occupied) & bishopsAndQueens);
+}
+
+bool GameState::isInCheck(PieceColors::ePieceColors color) const
+{
+  squareType king = _kingSquares[color];
+  if (king == eNoSquare) {
+    return false;
+  }
+
+  return (attackersTo(king, occupancy()) & _colors[PieceColors::flipColor(color)]) != 0;
+}
+
+bool GameState::isInsufficientMaterial() const
+{
+  for (int color = PieceColors::eBlack; color <= PieceColors::eWhite; ++color) {
+    if (_pieces[color][Pieces::Identities::ePawn] |
+        _pieces[color][Pieces::Identities::eCastle] |
+        _pieces[color][Pieces::Identities::eQueen]) {
+      return false;
+    }
+  }
+
+  bitBoardType knights = _pieces[PieceColors::eBlack][Pieces::Identities::eKnight] |
+                         _pieces[PieceColors::eWhite][Pieces::Identities::eKnight];
+  bitBoardType bishops = _pieces[PieceColors::eBlack][Pieces::Identities::eBishop] |
+                         _pieces[PieceColors::eWhite][Pieces::Identities::eBishop];
+
+  if (BitBoards::count(knights | bishops) <= 1) {
+    return true;
+  }
+
+  // Bishops that all travel on cells of the same colour can never attack a king on the other colour
+  return knights == 0 && ((bishops & evenSquares) == 0 || (bishops & ~evenSquares) == 0);
+}
+
+void GameState::setCastlingRights(int rights)
+{
+  const BitBoards& bitBoards = BitBoards::getInstance();
+
+  _hash ^= bitBoards.zobristCastling(_castlingRights) ^ bitBoards.zobristCastling(rights);
+  _castlingRights = rights;
+}
+
+void GameState::setEnPassantSquare(squareType square)
+{
+  const BitBoards& bitBoards = BitBoards::getInstance();
+
+  if (_enPassantSquare != eNoSquare) {
+    _hash ^= bitBoards.zobristEnPassant(_enPassantSquare);
+  }
+  if (square != eNoSquare) {
+    _hash ^= bitBoards.zobristEnPassant(square);
+  }
+  _enPassantSquare = square;
+}
+
+definedPieceType GameState::makeMove(squareType from, squareType to, Pieces::Identities::eIdentities promotion)
+{
+  squareType enPassantSquare = _enPassantSquare;
+  setEnPassantSquare(eNoSquare);
+
+  definedPieceType moving = lift(from);
+  definedPieceType taken;
+  if (_board[to].first != Pieces::Identities::eNone) {
+    taken = lift(to);
+  }
+
+  if (moving.first == Pieces::Identities::ePawn) {
+    PieceColors::ePieceColors enemyColor = PieceColors::flipColor(moving.second);
+
+    if (to == enPassantSquare) {
+      // The pawn taken en passant stands beside the capturing pawn, a row behind the destination
+      taken = lift(moving.second == PieceColors::eBlack ? to - 8 : to + 8);
+    }
+    else if (BitBoards::promotionRow(moving.second) & BitBoards::squareBit(to)) {
+      moving.first = promotion;
+    }
+    else if (qAbs(to - from) == 16) {
+      squareType passed = (from + to) / 2;
+
+      if (BitBoards::getInstance().pawnAttacks(moving.second, passed) & _pieces[enemyColor][Pieces::Identities::ePawn]) {
+        setEnPassantSquare(passed);
+      }
+    }
+  }
+  else if (moving.first == Pieces::Identities::eKing && qAbs(to - from) == 2) {
+    // Castling, the Castle jumps over the King, onto the square the King passed
+    squareType castleFrom = to > from ? from + 3 : from - 4;
+    place((from + to) / 2, lift(castleFrom));
+  }
+
+  place(to, moving);
+
+  int lost = castlingRightsLost(from) | castlingRightsLost(to);
+  if (_castlingRights & lost) {
+    setCastlingRights(_castlingRights & ~lost);
+  }
+  return taken;
+}
+
+bool GameState::readFen(const char* fen, PieceColors::ePieceColors& colorToMove, int* halfmoveClock, int* fullmoveNumber)
+{
+  // The position is built on the side, so that a malformed string leaves this state untouched
+  GameState state;
+  const char* text = fen;
+  int row = 1;
+  int column = 1;
+
+  for (; *text && *text != ' '; ++text) {
+    if (*text == '/') {
+      if (column != 9 || row == 8) {
+        return false;
+      }
+      ++row;
+      column = 1;
+    }
+    else if (*text >= '1' && *text <= '8') {
+      column += *text - '0';
+      if (column > 9) {
+        return false;
+      }
+    }
+    else {
+      Pieces::Identities::eIdentities identity = identityOfFenLetter(*text);
+      if (identity == Pieces::Identities::eNone || column > 8) {
+        return false;
+      }
+
+      PieceColors::ePieceColors color = (*text >= 'a') ? PieceColors::eBlack : PieceColors::eWhite;
+      state.place(BitBoards::square(boardCoordinateType(row, column++)), definedPieceType(identity, color));
+    }
+  }
+
+  if (row != 8 || column != 9 || *text++ != ' ') {
+    return false;
+  }
+
+  // Exactly one King a side, and no pawn where it could never have got to
+  bitBoardType pawns = state._pieces[PieceColors::eBlack][Pieces::Identities::ePawn] |
+                       state._pieces[PieceColors::eWhite][Pieces::Identities::ePawn];
+  if (BitBoards::count(state._pieces[PieceColors::eBlack][Pieces::Identities::eKing]) != 1 ||
+      BitBoards::count(state._pieces[PieceColors::eWhite][Pieces::Identities::eKing]) != 1 ||
+      (pawns & (BitBoards::promotionRow(PieceColors::eBlack) | BitBoards::promotionRow(PieceColors::eWhite)))) {
+    return false;
+  }
+
+  PieceColors::ePieceColors color;
+  switch (*text++) {
+  case 'w':
+    color = PieceColors::eWhite;
+    break;
+  case 'b':
+    color = PieceColors::eBlack;
+    break;
+  default :
+    return false;
+  }
+
+  int rights = CastlingRights::eNone;
+  if (*text++ != ' ') {
+    return false;
+  }
+  if (*text == '-') {
+    ++text;
+  }
+  else {
+    for (; *text && *text != ' '; ++text) {
+      switch (*text) {
+      case 'K': rights |= CastlingRights::eWhiteKingSide;  break;
+      case 'Q': rights |= CastlingRights::eWhiteQueenSide; break;
+      case 'k': rights |= CastlingRights::eBlackKingSide;  break;
+      case 'q': rights |= CastlingRights::eBlackQueenSide; break;
+      default : return false;
+      }
+    }
+  }
+
+  // A right is only kept while its King and Castle stand where they started
+  static const int rightsOrder[4] = { CastlingRights::eBlackKingSide, CastlingRights::eBlackQueenSide,
+                                      CastlingRights::eWhiteKingSide, CastlingRights::eWhiteQueenSide };
+  static const squareType castleHomes[4] = { eBlackKingSideCastle, eBlackQueenSideCastle,
+                                             eWhiteKingSideCastle, eWhiteQueenSideCastle };
+  for (int index = 0; index < 4; ++index) {
+    PieceColors::ePieceColors owner = index < 2 ? PieceColors::eBlack : PieceColors::eWhite;
+    squareType kingHome = index < 2 ? squareType(eBlackKing) : squareType(eWhiteKing);
+
+    if (state._kingSquares[owner] != kingHome ||
+        state._board[castleHomes[index]] != definedPieceType(Pieces::Identities::eCastle, owner)) {
+      rights &= ~rightsOrder[index];
+    }
+  }
+  state.setCastlingRights(rights);
+
+  if (*text++ != ' ') {
+    return false;
+  }
+  if (*text == '-') {
+    ++text;
+  }
+  else {
+    if (text[0] < 'a' || text[0] > 'h' || text[1] < '1' || text[1] > '8') {
+      return false;
+    }
+
+    // Only kept if an enemy pawn can just have passed over it, two rows from its start, and a pawn of the
+    // side to move stands ready to capture.  The enemy pawn stands one row past the square towards the side
+    // to move, and the square it came from is empty.
+    squareType target = BitBoards::square(boardCoordinateType(9 - (text[1] - '0'), text[0] - 'a' + 1));
+    PieceColors::ePieceColors enemy = PieceColors::flipColor(color);
+    bool passedOver = text[1] == (color == PieceColors::eWhite ? '6' : '3');
+    squareType pawnSquare = color == PieceColors::eWhite ? target + 8 : target - 8;
+    squareType startSquare = color == PieceColors::eWhite ? target - 8 : target + 8;
+
+    if (passedOver &&
+        state._board[target].first == Pieces::Identities::eNone &&
+        state._board[startSquare].first == Pieces::Identities::eNone &&
+        state._board[pawnSquare] == definedPieceType(Pieces::Identities::ePawn, enemy) &&
+        (BitBoards::getInstance().pawnAttacks(enemy, target) & state._pieces[color][Pieces::Identities::ePawn])) {
+      state.setEnPassantSquare(target);
+    }
+    text += 2;
+  }
+
+  int halfmoves = 0;
+  int fullmoves = 1;
+  if (*text == ' ') {
+    ++text;
+    if (!readNumber(text, halfmoves)) {
+      return false;
+    }
+    if (*text == ' ') {
+      ++text;
+      if (!readNumber(text, fullmoves)) {
+        return false;
+      }
+    }
+  }
+
+  *this = state;
+  colorToMove = color;
+  if (halfmoveClock) {
+    *halfmoveClock = halfmoves;
+  }
+  if (fullmoveNumber) {
+    *fullmoveNumber = fullmoves;
+  }
+  return true;
+}
+
+int GameState::writeFen(char* buffer, PieceColors::ePieceColors colorToMove, int halfmoveClock, int fullmoveNumber) const
+{
+  char* text = buffer;
+
+  for (int row = 1; row <= 8; ++row) {
+    int emptyCells = 0;
+
+    for (int column = 1; column <= 8; ++column) {
+      const definedPieceType& piece = _board[BitBoards::square(boardCoordinateType(row, column))];
+
+      if (piece.first == Pieces::Identities::eNone) {
+        ++emptyCells;
+        continue;
+      }
+
+      if (emptyCells) {
+        *text++ = char('0' + emptyCells);
+        emptyCells = 0;
+      }
+
+      char letter = fenLetters[piece.first];
+      *text++ = piece.second == PieceColors::eWhite ? char(letter - 'a' + 'A') : letter;
+    }
+
+    if (emptyCells) {
+      *text++ = char('0' + emptyCells);
+    }
+    if (row < 8) {
+      *text++ = '/';
+    }
+  }
+
+  *text++ = ' ';
+  *text++ = colorToMove == PieceColors::eBlack ? 'b' : 'w';
+  *text++ = ' ';
+
+  if (_castlingRights == CastlingRights::eNone) {
+    *text++ = '-';
+  }
+  if (_castlingRights & CastlingRights::eWhiteKingSide) {
+    *text++ = 'K';
+  }
+  if (_castlingRights & CastlingRights::eWhiteQueenSide) {
+    *text++ = 'Q';
+  }
+  if (_castlingRights & CastlingRights::eBlackKingSide) {
+    *text++ = 'k';
+  }
+  if (_castlingRights & CastlingRights::eBlackQueenSide) {
+    *text++ = 'q';
+  }
+
+  *text++ = ' ';
+  if (_enPassantSquare == eNoSquare) {
+    *text++ = '-';
+  }
+  else {
+    boardCoordinateType target = BitBoards::coordinate(_enPassantSquare);
+    *text++ = char('a' + target.second - 1);
+    *text++ = char('0' + 9 - target.first);
+  }
+
+  *text++ = ' ';
+  writeNumber(text, halfmoveClock);
+  *text++ = ' ';
+  writeNumber(text, fullmoveNumber);
+  *text = '\0';
+
+  return int(text - buffer);
+}
+
+void GameState::place(squareType square, const definedPieceType& piece)
+{
+  bitBoardType bit = BitBoards::squareBit(square);
+
+  _board[square] = piece;
+  _colors[piece.second] |= bit;
+  _pieces[piece.second][piece.first] |= bit;
+  _hash ^= BitBoards::getInstance().zobrist(piece.second, piece.first, square);
+
+  if (piece.first == Pieces::Identities::eKing) {
+    _kingSquares[piece.second] = square;
+  }
+}
+
+definedPieceType GameState::lift(squareType square)
+{
+  definedPieceType piece = _board[square];
+  bitBoardType bit = BitBoards::squareBit(square);
+
+  _board[square] = definedPieceType(Pieces::Identities::eNone, PieceColors::eNone);
+  _colors[piece.second] &= ~bit;
+  _pieces[piece.second][piece.first] &= ~bit;
+  _hash ^= BitBoards::getInstance().zobrist(piece.second, piece.first, square);
+
+  if (piece.first == Pieces::Identities::eKing && _kingSquares[piece.second] == square) {
+    _kingSquares[piece.second] = eNoSquare;
+  }
+  return piece;
+}
@@ -0,0 +1,389 @@
+///
+/// \file   GameState.h
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This file contains structure definitions and members of the GameState class.
+///
+
+#ifndef GAMESTATE_H
+#define GAMESTATE_H
+
+#include "CommonTypeDefinitions.h"
+#include "BitBoards.h"
+
+///
+/// The GameState class stores the pieces on a board, along with per-colour and per-identity sets of squares.
+///
+/// A GameState offers the same interface the board state QMap used to offer (value, insert, remove, take,
+/// contains, ...), so that it can be used as a boardStateMapType.  Every change to the board also updates
+/// a bit board per colour and identity, and the square of each king.  This means that questions like
+/// "where is the white king?" or "where are the black knights?" no longer require a scan of all 64 cells.
+///
+/// Besides the pieces, a GameState holds what the pieces alone do not tell: which castling rights are left,
+/// and on which square a pawn may be captured en passant.  makeMove() plays a move by the full rules,
+/// keeping both up to date, while insert() and take() only ever touch the piece on a single square.
+///
+/// GameState only holds plain data, copying one is a single block copy.
+///
+class GameState
+{
+
+public:
+
+  ///
+  /// GameState is the default constructor for objects of GameState, creating an empty board.
+  ///
+  GameState();
+
+  ///
+  /// value gives the piece on a coordinate.
+  ///
+  /// \param coordinate [in] the (row,column) coordinate to inspect, may be off the board.
+  /// \param defaultValue [in] the value to return if there is no piece on the coordinate.
+  /// \return the piece on the coordinate, or defaultValue if the coordinate is empty or off the board.
+  ///
+  definedPieceType value(const boardCoordinateType& coordinate,
+                         const definedPieceType& defaultValue = definedPieceType()) const;
+
+  ///
+  /// insert places a piece on a coordinate, replacing the piece that may already be there.
+  ///
+  /// \param coordinate [in] the (row,column) coordinate to place the piece on.
+  /// \param piece [in] the piece to place.  Placing a piece of identity eNone empties the coordinate.
+  ///
+  void insert(const boardCoordinateType& coordinate, const definedPieceType& piece);
+
+  ///
+  /// remove removes the piece on a coordinate.
+  ///
+  /// \param coordinate [in] the (row,column) coordinate to empty.
+  /// \return the number of pieces removed, 0 or 1.
+  ///
+  int remove(const boardCoordinateType& coordinate);
+
+  ///
+  /// take removes the piece on a coordinate and returns it.
+  ///
+  /// \param coordinate [in] the (row,column) coordinate to empty.
+  /// \return the piece that was removed, or an eNone piece if the coordinate was empty.
+  ///
+  definedPieceType take(const boardCoordinateType& coordinate);
+
+  ///
+  /// contains determines whether there is a piece on a coordinate.
+  ///
+  /// \param coordinate [in] the (row,column) coordinate to inspect.
+  /// \return true if a piece stands on the coordinate.
+  ///
+  bool contains(const boardCoordinateType& coordinate) const;
+
+  ///
+  /// isEmpty determines whether there are no pieces on the board at all.
+  ///
+  /// \return true if the board is empty.
+  ///
+  bool isEmpty() const;
+
+  ///
+  /// size gives the number of pieces on the board.
+  ///
+  /// \return the number of pieces.
+  ///
+  int size() const;
+
+  ///
+  /// clear removes every piece from the board, along with the castling rights and the en passant square.
+  ///
+  void clear();
+
+  ///
+  /// operator == determines whether two states have the same pieces on the same squares, and the same rights.
+  ///
+  /// \param other [in] the state to compare with.
+  /// \return true if every square holds the same piece in both states.
+  ///
+  bool operator==(const GameState& other) const;
+
+  ///
+  /// operator != determines whether two states differ in at least one square.
+  ///
+  /// \param other [in] the state to compare with.
+  /// \return true if any square holds a different piece in the two states.
+  ///
+  bool operator!=(const GameState& other) const;
+
+  ///
+  /// pieceOn gives the piece on a square.
+  ///
+  /// \param square [in] the square index, ranging from 0 to 63.
+  /// \return the piece on the square, an eNone piece if it is empty.
+  ///
+  inline const definedPieceType& pieceOn(squareType square) const
+  {
+    return _board[square];
+  }
+
+  ///
+  /// occupancy gives the squares of every piece on the board.
+  ///
+  /// \return a bit board of all occupied squares.
+  ///
+  inline bitBoardType occupancy() const
+  {
+    return _colors[PieceColors::eBlack] | _colors[PieceColors::eWhite];
+  }
+
+  ///
+  /// pieces gives the squares of all pieces of a colour.
+  ///
+  /// \param color [in] the colour of the pieces.
+  /// \return a bit board of the squares the pieces of that colour stand on.
+  ///
+  inline bitBoardType pieces(PieceColors::ePieceColors color) const
+  {
+    return _colors[color];
+  }
+
+  ///
+  /// pieces gives the squares of all pieces of a colour and identity.
+  ///
+  /// \param color [in] the colour of the pieces.
+  /// \param identity [in] the identity of the pieces.
+  /// \return a bit board of the squares the pieces of that colour and identity stand on.
+  ///
+  inline bitBoardType pieces(PieceColors::ePieceColors color, Pieces::Identities::eIdentities identity) const
+  {
+    return _pieces[color][identity];
+  }
+
+  ///
+  /// kingSquare gives the square of the king of a colour.
+  ///
+  /// \param color [in] the colour of the king.
+  /// \return the square of the king, or eNoSquare if that king is not on the board.
+  ///
+  inline squareType kingSquare(PieceColors::ePieceColors color) const
+  {
+    return _kingSquares[color];
+  }
+
+  ///
+  /// kingLocation gives the coordinate of the king of a colour.
+  ///
+  /// \param color [in] the colour of the king.
+  /// \return the (row,column) coordinate of the king, or (0,0) if that king is not on the board.
+  ///
+  boardCoordinateType kingLocation(PieceColors::ePieceColors color) const;
+
+  ///
+  /// attackersTo gives the squares of every piece, of either colour, that attacks a square.
+  ///
+  /// The square is looked at as if it held each kind of piece in turn: a knight on the square attacks
+  /// exactly the squares knights attack it from, and the same holds for kings, sliding pieces and
+  /// (with the colours swapped) pawns.
+  ///
+  /// \param square [in] the square to inspect.
+  /// \param occupied [in] the occupied squares to use for the sliding pieces, normally occupancy().
+  /// \return a bit board of the squares of all attacking pieces.
+  ///
+  bitBoardType attackersTo(squareType square, bitBoardType occupied) const;
+
+  ///
+  /// isInCheck determines whether the king of a colour is attacked.
+  ///
+  /// Only the square of the king is looked at, no moves are mapped.  As the colour is passed in,
+  /// rather than taken from the player whose turn it is, any GameState can be asked at any time.
+  ///
+  /// \param color [in] the colour of the king.
+  /// \return true if the king is attacked by at least one enemy piece, false if not, or if there is no such king.
+  ///
+  bool isInCheck(PieceColors::ePieceColors color) const;
+
+  ///
+  /// isInsufficientMaterial determines whether neither side has the pieces left to ever mate the other.
+  ///
+  /// The position is dead if no Pawn, Castle or Queen remains, and either:
+  /// * there is at most one Knight or Bishop on the board, or
+  /// * only Bishops remain, all of them on cells of the same colour.
+  ///
+  /// \return true if the game can no longer be won by either side.
+  ///
+  bool isInsufficientMaterial() const;
+
+  ///
+  /// hash gives the Zobrist key of the board state, kept up to date as pieces are placed and lifted.
+  ///
+  /// \return a key that is equal for equal board states, and almost certainly different for different ones.
+  ///
+  inline hashType hash() const
+  {
+    return _hash;
+  }
+
+  ///
+  /// castlingRights gives the castling rights left in the board state.
+  ///
+  /// \return a combination of CastlingRights::eCastlingRights flags.
+  ///
+  inline int castlingRights() const
+  {
+    return _castlingRights;
+  }
+
+  ///
+  /// setCastlingRights replaces the castling rights of the board state.
+  ///
+  /// \param rights [in] a combination of CastlingRights::eCastlingRights flags.
+  ///
+  void setCastlingRights(int rights);
+
+  ///
+  /// enPassantSquare gives the square a pawn that just moved two rows may be captured on, en passant.
+  ///
+  /// The square is only set if an enemy pawn stands ready to make the capture, so that positions that
+  /// only differ in an en passant square nobody can use are still equal.
+  ///
+  /// \return the square passed over by the pawn, or eNoSquare.
+  ///
+  inline squareType enPassantSquare() const
+  {
+    return _enPassantSquare;
+  }
+
+  ///
+  /// setEnPassantSquare replaces the en passant square of the board state.
+  ///
+  /// \param square [in] the square passed over by a pawn that moved two rows, or eNoSquare.
+  ///
+  void setEnPassantSquare(squareType square);
+
+  ///
+  /// makeMove plays a move, which is assumed to be legal, by the full rules of Chess.
+  ///
+  /// Apart from moving the piece and taking the piece on the destination, makeMove:
+  /// * moves the Castle along when the King moves two columns, i.e. castles,
+  /// * takes the pawn passed by when a pawn moves to the en passant square,
+  /// * promotes a pawn that reaches the last row,
+  /// * withdraws the castling rights of a King or Castle that moves or is taken,
+  /// * sets the en passant square after a pawn moved two rows.
+  ///
+  /// \param from [in] the square of the piece to move.
+  /// \param to [in] the square to move it to.
+  /// \param promotion [in] the identity a pawn that reaches the last row becomes.
+  /// \return the piece that was taken, an eNone piece if none was.
+  ///
+  definedPieceType makeMove(squareType from,
+                            squareType to,
+                            Pieces::Identities::eIdentities promotion = Pieces::Identities::eQueen);
+
+  ///
+  /// readFen sets the board state up from a position in Forsyth-Edwards Notation.
+  ///
+  /// FEN lists the rows from black's side of the board, row 1, to white's side, row 8, and the columns
+  /// from 1 to 8, i.e. from file a to file h.  The string is read in place, no memory is allocated, so
+  /// thousands of positions can be set up in a fraction of a second.  The halfmove clock and fullmove
+  /// number may be left out, as in EPD.  Castling rights whose King or Castle is not on its starting
+  /// square are dropped, as is an en passant square no enemy pawn can just have passed over, or no pawn can capture on.
+  ///
+  /// \param fen [in] the zero-terminated position, e.g. "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1".
+  /// \param colorToMove [out] the colour of the side to move.
+  /// \param halfmoveClock [out] if not null, the number of moves since the last capture or pawn move.
+  /// \param fullmoveNumber [out] if not null, the number of the move about to be played.
+  /// \return true if the position was read, false if the string is malformed, in which case the state is left as it was.
+  ///
+  bool readFen(const char* fen,
+               PieceColors::ePieceColors& colorToMove,
+               int* halfmoveClock = 0,
+               int* fullmoveNumber = 0);
+
+  ///
+  /// writeFen writes the board state out in Forsyth-Edwards Notation, without allocating memory.
+  ///
+  /// \param buffer [out] the buffer to write to, at least eMaxFenLength characters long.  The string is zero-terminated.
+  /// \param colorToMove [in] the colour of the side to move.
+  /// \param halfmoveClock [in] the number of moves since the last capture or pawn move.
+  /// \param fullmoveNumber [in] the number of the move about to be played.
+  /// \return the number of characters written, not counting the terminating zero.
+  ///
+  int writeFen(char* buffer,
+               PieceColors::ePieceColors colorToMove,
+               int halfmoveClock = 0,
+               int fullmoveNumber = 1) const;
+
+  ///
+  /// eMaxFenLength is the size of a buffer that can hold any position writeFen() writes, terminating zero included.
+  ///
+  static const int eMaxFenLength = 100;
+
+  ///
+  /// eNoSquare is the square value used where a square is expected, but there is none.
+  ///
+  static const squareType eNoSquare = -1;
+
+  ///
+  /// isOnTheBoard determines whether a coordinate lies on the board.
+  ///
+  /// \param coordinate [in] the (row,column) coordinate to test.
+  /// \return true if both row and column range from 1 to 8.
+  ///
+  static inline bool isOnTheBoard(const boardCoordinateType& coordinate)
+  {
+    return coordinate.first >= 1 && coordinate.first <= 8 && coordinate.second >= 1 && coordinate.second <= 8;
+  }
+
+private:
+
+  ///
+  /// place puts a piece on an empty square, updating the bit boards and king squares.
+  ///
+  /// \param square [in] the empty square.
+  /// \param piece [in] the piece to place.
+  ///
+  void place(squareType square, const definedPieceType& piece);
+
+  ///
+  /// lift removes the piece from an occupied square, updating the bit boards and king squares.
+  ///
+  /// \param square [in] the occupied square.
+  /// \return the piece that was removed.
+  ///
+  definedPieceType lift(squareType square);
+
+  ///
+  /// _board is the private member that stores the piece on each square, eNone for empty squares.
+  ///
+  definedPieceType _board[64];
+
+  ///
+  /// _colors is the private member that stores the squares occupied by each colour.
+  ///
+  bitBoardType _colors[PieceColors::eMax + 1];
+
+  ///
+  /// _pieces is the private member that stores the squares occupied by each colour and identity.
+  ///
+  bitBoardType _pieces[PieceColors::eMax + 1][Pieces::Identities::eMax + 1];
+
+  ///
+  /// _kingSquares is the private member that stores the square of each king, eNoSquare if it is not on the board.
+  ///
+  squareType _kingSquares[PieceColors::eMax + 1];
+
+  ///
+  /// _hash is the private member that stores the Zobrist key of the pieces on the board.
+  ///
+  hashType _hash;
+
+  ///
+  /// _castlingRights is the private member that stores the combination of castling rights left.
+  ///
+  int _castlingRights;
+
+  ///
+  /// _enPassantSquare is the private member that stores the en passant square, eNoSquare if there is none.
+  ///
+  squareType _enPassantSquare;
+};
+
+#endif // GAMESTATE_H
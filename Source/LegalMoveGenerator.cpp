@@ -0,0 +1,343 @@
+///
+/// \file   LegalMoveGenerator.cpp
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This file contains the inner management features of the LegalMoveTable struct and the LegalMoveGenerator class.
+///
+/// In this cpp file is housed the generation of legal moves from attack sets.  Checks and pins
+/// are found once, for the king, and every piece's moves are then restricted by a mask instead
+/// of being played out on a copy of the board.
+///
+
+#include "LegalMoveGenerator.h"
+
+namespace
+{
+  ///
+  /// The eRows enum names the rows pawn moves depend on.  They match those of Board, without
+  /// pulling the widget into the move generation.
+  ///
+  enum eRows {
+    eFirstRow          = 1, ///< enum value eFirstRow is the row white pawns move towards.
+    eBlackPawnsRow     = 2, ///< enum value eBlackPawnsRow is the row black pawns start on.
+    eWhitePawnsRow     = 7, ///< enum value eWhitePawnsRow is the row white pawns start on.
+    eLastRow           = 8  ///< enum value eLastRow is the row black pawns move towards.
+  };
+
+  ///
+  /// The eKingHomeSquares enum names the squares a King has to stand on in order to castle.
+  ///
+  enum eKingHomeSquares {
+    eBlackKingHome     = 4,  ///< enum value eBlackKingHome is the square (1,5).
+    eWhiteKingHome     = 60  ///< enum value eWhiteKingHome is the square (8,5).
+  };
+}
+
+LegalMoveTable::LegalMoveTable()
+{
+  clear();
+}
+
+void LegalMoveTable::clear()
+{
+  color = PieceColors::eNone;
+  origins = 0;
+  promotions = 0;
+
+  for (squareType square = 0; square < 64; ++square) {
+    destinations[square] = 0;
+  }
+}
+
+int LegalMoveTable::moveCount() const
+{
+  int count = 0;
+  bitBoardType remaining = origins;
+
+  while (remaining) {
+    count += BitBoards::count(destinations[BitBoards::popLowestSquare(remaining)]);
+  }
+
+  // A pawn reaching the last row may become a Queen, Castle, Bishop or Knight, four moves per destination
+  remaining = promotions;
+  while (remaining) {
+    count += 3 * BitBoards::count(destinations[BitBoards::popLowestSquare(remaining)]);
+  }
+  return count;
+}
+
+LegalMoveGenerator::LegalMoveGenerator(const boardStateMapType& state, PieceColors::ePieceColors colorToMove) :
+  _state(state),
+  _colorToMove(colorToMove),
+  _kingSquare(state.kingSquare(colorToMove)),
+  _checkers(0),
+  _checkMask(~bitBoardType(0)),
+  _pinned(0)
+{
+  if (_kingSquare == GameState::eNoSquare) {
+    return;
+  }
+
+  const BitBoards& bitBoards = BitBoards::getInstance();
+  PieceColors::ePieceColors enemyColor = PieceColors::flipColor(_colorToMove);
+  bitBoardType occupied = _state.occupancy();
+
+  _checkers = _state.attackersTo(_kingSquare, occupied) & _state.pieces(enemyColor);
+
+  if (BitBoards::count(_checkers) == 1) {
+    squareType checker = BitBoards::lowestSquare(_checkers);
+    _checkMask = _checkers | bitBoards.between(_kingSquare, checker);
+  }
+  else if (_checkers) {
+    _checkMask = 0; // double check, only the king can move
+  }
+
+  // Enemy sliding pieces that would see the king on an empty board, with exactly one own piece in between, pin that piece
+  bitBoardType enemyQueens = _state.pieces(enemyColor, Pieces::Identities::eQueen);
+  bitBoardType snipers = (bitBoards.castleAttacks(_kingSquare, 0) & (_state.pieces(enemyColor, Pieces::Identities::eCastle) | enemyQueens)) |
+                         (bitBoards.bishopAttacks(_kingSquare, 0) & (_state.pieces(enemyColor, Pieces::Identities::eBishop) | enemyQueens));
+
+  while (snipers) {
+    bitBoardType blockers = bitBoards.between(_kingSquare, BitBoards::popLowestSquare(snipers)) & occupied;
+
+    if (BitBoards::count(blockers) == 1) {
+      _pinned |= blockers & _state.pieces(_colorToMove);
+    }
+  }
+}
+
+LegalMoveGenerator::~LegalMoveGenerator()
+{
+
+}
+
+void LegalMoveGenerator::generate(LegalMoveTable& table) const
+{
+  table.clear();
+  table.color = _colorToMove;
+
+  bitBoardType pawns = _state.pieces(_colorToMove, Pieces::Identities::ePawn);
+  bitBoardType lastRow = BitBoards::promotionRow(_colorToMove);
+
+  bitBoardType pieces = _state.pieces(_colorToMove);
+  while (pieces) {
+    squareType from = BitBoards::popLowestSquare(pieces);
+    bitBoardType destinations = destinationsFrom(from);
+
+    if (destinations) {
+      table.origins |= BitBoards::squareBit(from);
+      table.destinations[from] = destinations;
+
+      if ((pawns & BitBoards::squareBit(from)) && (destinations & lastRow)) {
+        table.promotions |= BitBoards::squareBit(from);
+      }
+    }
+  }
+}
+
+bitBoardType LegalMoveGenerator::destinationsFrom(squareType from) const
+{
+  const definedPieceType& piece = _state.pieceOn(from);
+  if (piece.second != _colorToMove) {
+    return 0;
+  }
+
+  if (piece.first == Pieces::Identities::eKing) {
+    return kingDestinations();
+  }
+
+  const BitBoards& bitBoards = BitBoards::getInstance();
+  bitBoardType occupied = _state.occupancy();
+  bitBoardType destinations = 0;
+
+  switch (piece.first) {
+  case Pieces::Identities::ePawn   :
+    destinations = pawnDestinations(from);
+    break;
+  case Pieces::Identities::eKnight :
+    destinations = bitBoards.knightAttacks(from);
+    break;
+  case Pieces::Identities::eBishop :
+    destinations = bitBoards.bishopAttacks(from, occupied);
+    break;
+  case Pieces::Identities::eCastle :
+    destinations = bitBoards.castleAttacks(from, occupied);
+    break;
+  case Pieces::Identities::eQueen  :
+    destinations = bitBoards.queenAttacks(from, occupied);
+    break;
+  default                          :
+    break;
+  }
+
+  destinations &= ~_state.pieces(_colorToMove) & _checkMask;
+
+  // A pinned piece may only move along the line it is pinned on
+  if (_pinned & BitBoards::squareBit(from)) {
+    destinations &= bitBoards.line(_kingSquare, from);
+  }
+
+  if (piece.first == Pieces::Identities::ePawn) {
+    destinations |= enPassantDestination(from);
+  }
+  return destinations;
+}
+
+bool LegalMoveGenerator::hasLegalMove() const
+{
+  if (kingDestinations()) {
+    return true;
+  }
+
+  // In double check, a king that cannot move is mated
+  if (_checkers && _checkMask == 0) {
+    return false;
+  }
+
+  // A pinned piece can at best move along its pin, so those are the least likely to have a move
+  bitBoardType others = _state.pieces(_colorToMove) & ~_state.pieces(_colorToMove, Pieces::Identities::eKing);
+  bitBoardType unpinned = others & ~_pinned;
+  bitBoardType pinned = others & _pinned;
+
+  while (unpinned) {
+    if (destinationsFrom(BitBoards::popLowestSquare(unpinned))) {
+      return true;
+    }
+  }
+
+  while (pinned) {
+    if (destinationsFrom(BitBoards::popLowestSquare(pinned))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool LegalMoveGenerator::isInCheck() const
+{
+  return _checkers != 0;
+}
+
+bitBoardType LegalMoveGenerator::checkers() const
+{
+  return _checkers;
+}
+
+bitBoardType LegalMoveGenerator::kingDestinations() const
+{
+  if (_kingSquare == GameState::eNoSquare) {
+    return 0;
+  }
+
+  PieceColors::ePieceColors enemyColor = PieceColors::flipColor(_colorToMove);
+  bitBoardType candidates = BitBoards::getInstance().kingAttacks(_kingSquare) & ~_state.pieces(_colorToMove);
+  bitBoardType withoutKing = _state.occupancy() & ~BitBoards::squareBit(_kingSquare);
+  bitBoardType destinations = 0;
+
+  while (candidates) {
+    squareType to = BitBoards::popLowestSquare(candidates);
+
+    if (!(_state.attackersTo(to, withoutKing) & _state.pieces(enemyColor))) {
+      destinations |= BitBoards::squareBit(to);
+    }
+  }
+  return destinations | castlingDestinations();
+}
+
+bitBoardType LegalMoveGenerator::pawnDestinations(squareType from) const
+{
+  bitBoardType empty = ~_state.occupancy();
+  int row = BitBoards::coordinate(from).first;
+  bitBoardType destinations = BitBoards::getInstance().pawnAttacks(_colorToMove, from) &
+                              _state.pieces(PieceColors::flipColor(_colorToMove));
+
+  // Black plays down the rows, towards row 8, white plays up the rows, towards row 1
+  if (_colorToMove == PieceColors::eBlack) {
+    if (row < eLastRow) {
+      bitBoardType singlePush = BitBoards::squareBit(from + 8) & empty;
+      destinations |= singlePush;
+
+      if (singlePush && row == eBlackPawnsRow) {
+        destinations |= BitBoards::squareBit(from + 16) & empty;
+      }
+    }
+  }
+  else {
+    if (row > eFirstRow) {
+      bitBoardType singlePush = BitBoards::squareBit(from - 8) & empty;
+      destinations |= singlePush;
+
+      if (singlePush && row == eWhitePawnsRow) {
+        destinations |= BitBoards::squareBit(from - 16) & empty;
+      }
+    }
+  }
+  return destinations;
+}
+
+bitBoardType LegalMoveGenerator::castlingDestinations() const
+{
+  squareType home = _colorToMove == PieceColors::eBlack ? eBlackKingHome : eWhiteKingHome;
+  int kingSide = _colorToMove == PieceColors::eBlack ? CastlingRights::eBlackKingSide : CastlingRights::eWhiteKingSide;
+  int queenSide = _colorToMove == PieceColors::eBlack ? CastlingRights::eBlackQueenSide : CastlingRights::eWhiteQueenSide;
+
+  // A checked King may not castle out of check
+  if (_kingSquare != home || _checkers || !(_state.castlingRights() & (kingSide | queenSide))) {
+    return 0;
+  }
+
+  const BitBoards& bitBoards = BitBoards::getInstance();
+  PieceColors::ePieceColors enemyColor = PieceColors::flipColor(_colorToMove);
+  bitBoardType occupied = _state.occupancy();
+  bitBoardType castles = _state.pieces(_colorToMove, Pieces::Identities::eCastle);
+  bitBoardType destinations = 0;
+
+  for (int side = 0; side < 2; ++side) {
+    bool towardsKingSide = side == 0;
+    squareType castle = towardsKingSide ? home + 3 : home - 4;
+    squareType kingTo = towardsKingSide ? home + 2 : home - 2;
+
+    if (!(_state.castlingRights() & (towardsKingSide ? kingSide : queenSide)) ||
+        !(castles & BitBoards::squareBit(castle)) ||
+        (bitBoards.between(home, castle) & occupied)) {
+      continue;
+    }
+
+    // The King may not pass over, nor land on, a square the enemy attacks
+    bitBoardType path = bitBoards.between(home, kingTo) | BitBoards::squareBit(kingTo);
+    bool isSafe = true;
+
+    while (path && isSafe) {
+      isSafe = !(_state.attackersTo(BitBoards::popLowestSquare(path), occupied) & _state.pieces(enemyColor));
+    }
+
+    if (isSafe) {
+      destinations |= BitBoards::squareBit(kingTo);
+    }
+  }
+  return destinations;
+}
+
+bitBoardType LegalMoveGenerator::enPassantDestination(squareType from) const
+{
+  squareType target = _state.enPassantSquare();
+  if (target == GameState::eNoSquare ||
+      !(BitBoards::getInstance().pawnAttacks(_colorToMove, from) & BitBoards::squareBit(target))) {
+    return 0;
+  }
+
+  if (_kingSquare == GameState::eNoSquare) {
+    return BitBoards::squareBit(target);
+  }
+
+  // Both pawns leave the row the capture is made on, which can uncover the King in ways no pin foresees
+  squareType taken = _colorToMove == PieceColors::eBlack ? target - 8 : target + 8;
+  bitBoardType occupied = (_state.occupancy() & ~BitBoards::squareBit(from) & ~BitBoards::squareBit(taken)) |
+                          BitBoards::squareBit(target);
+  bitBoardType attackers = _state.attackersTo(_kingSquare, occupied) &
+                           _state.pieces(PieceColors::flipColor(_colorToMove)) &
+                           ~BitBoards::squareBit(taken);
+
+  return attackers ? 0 : BitBoards::squareBit(target);
+}
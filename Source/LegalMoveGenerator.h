@@ -0,0 +1,200 @@
+///
+/// \file   LegalMoveGenerator.h
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This file contains structure definitions and members of the LegalMoveTable struct and the LegalMoveGenerator class.
+///
+
+#ifndef LEGALMOVEGENERATOR_H
+#define LEGALMOVEGENERATOR_H
+
+#include "CommonTypeDefinitions.h"
+#include "GameState.h"
+
+///
+/// The LegalMoveTable struct holds every legal move of one side, indexed by the square the moves start from.
+///
+struct LegalMoveTable {
+
+  ///
+  /// LegalMoveTable is the default constructor for objects of LegalMoveTable, creating an empty table.
+  ///
+  LegalMoveTable();
+
+  ///
+  /// clear empties the table.
+  ///
+  void clear();
+
+  ///
+  /// moveCount gives the number of moves in the table.
+  ///
+  /// \return the sum of the destinations of every origin, a promotion counting once for each piece it may promote to.
+  ///
+  int moveCount() const;
+
+  ///
+  /// color is the colour of the side the moves belong to.
+  ///
+  PieceColors::ePieceColors color;
+
+  ///
+  /// origins holds the squares of the pieces that have at least one legal move.
+  ///
+  bitBoardType origins;
+
+  ///
+  /// promotions holds the squares of the pawns whose moves all promote.  Each of their destinations counts as four moves.
+  ///
+  bitBoardType promotions;
+
+  ///
+  /// destinations holds, per square, the squares the piece on it may legally move to.
+  ///
+  bitBoardType destinations[64];
+};
+
+///
+/// The LegalMoveGenerator class generates the fully legal moves of one side, using the bit boards of a GameState.
+///
+/// Upon construction the generator finds the pieces checking the king, and the pieces pinned against it.
+/// From then on the legal destinations of any piece follow from its attack set, restricted to:
+/// * the cells that resolve the check (capturing the checker, or blocking it), if the king is checked,
+/// * the line between the king and the pinning piece, if the piece is pinned.
+///
+/// The king itself may go wherever it is not attacked, with the king taken off the board so that it
+/// cannot hide behind itself along the line of a sliding attacker.  Castling shows up as the king moving
+/// two columns.  No move is ever played out to see whether it is legal, apart from an en passant capture,
+/// which takes two pieces off a single row at once, and is checked against the occupancy alone.
+///
+/// Example usage:
+/// \code
+///  LegalMoveGenerator generator(state, PieceColors::eWhite);
+///  LegalMoveTable table;
+///  generator.generate(table);
+///  bitBoardType whereTheKnightMayGo = table.destinations[knightSquare];
+/// \endcode
+///
+class LegalMoveGenerator
+{
+
+public:
+
+  ///
+  /// LegalMoveGenerator is the constructor for objects of the LegalMoveGenerator class.
+  ///
+  /// \param state [in] is the board state to generate moves in.  It must outlive the LegalMoveGenerator.
+  /// \param colorToMove [in] is the colour of the side to generate moves for.
+  ///
+  LegalMoveGenerator(const boardStateMapType& state, PieceColors::ePieceColors colorToMove);
+
+  ///
+  /// ~LegalMoveGenerator is the default destructor for objects of type LegalMoveGenerator.
+  ///
+  virtual ~LegalMoveGenerator();
+
+  ///
+  /// generate fills a table with every legal move of the side to move.
+  ///
+  /// \param table [out] is the table to fill.
+  ///
+  void generate(LegalMoveTable& table) const;
+
+  ///
+  /// destinationsFrom gives the legal destinations of the piece on a square.
+  ///
+  /// \param from [in] the square of the piece.
+  /// \return the squares the piece may move to, empty if the square does not hold a piece of the side to move.
+  ///
+  bitBoardType destinationsFrom(squareType from) const;
+
+  ///
+  /// hasLegalMove determines whether the side to move has at least one legal move, without generating them all.
+  ///
+  /// The king is tried first, as it is the only piece that may move in double check, then the pieces that
+  /// are not pinned, and the pinned pieces last.  The search stops at the first piece that can move, so
+  /// deciding on checkmate or stalemate costs no more than a handful of attack set lookups.
+  ///
+  /// \return true if any legal move exists, false if the side to move is mated or stalemated.
+  ///
+  bool hasLegalMove() const;
+
+  ///
+  /// isInCheck determines whether the king of the side to move is checked.
+  ///
+  /// \return true if at least one enemy piece attacks the king.
+  ///
+  bool isInCheck() const;
+
+  ///
+  /// checkers gives the squares of the enemy pieces that check the king.
+  ///
+  /// \return a bit board of the checking pieces, empty if the king is not checked.
+  ///
+  bitBoardType checkers() const;
+
+private:
+
+  ///
+  /// kingDestinations gives the squares the king may move to without being attacked.
+  ///
+  /// \return the legal destinations of the king.
+  ///
+  bitBoardType kingDestinations() const;
+
+  ///
+  /// pawnDestinations gives the squares a pawn may move to, ignoring checks and pins.
+  ///
+  /// \param from [in] the square of the pawn.
+  /// \return the pushes and captures of the pawn.
+  ///
+  bitBoardType pawnDestinations(squareType from) const;
+
+  ///
+  /// castlingDestinations gives the squares the king may castle to.
+  ///
+  /// \return the squares two columns away from the king, for each side castling is allowed to.
+  ///
+  bitBoardType castlingDestinations() const;
+
+  ///
+  /// enPassantDestination gives the en passant square, if a pawn may legally capture on it.
+  ///
+  /// \param from [in] the square of the pawn.
+  /// \return the en passant square, or an empty bit board.
+  ///
+  bitBoardType enPassantDestination(squareType from) const;
+
+  ///
+  /// _state is the board state moves are generated in.
+  ///
+  const boardStateMapType& _state;
+
+  ///
+  /// _colorToMove is the colour of the side moves are generated for.
+  ///
+  PieceColors::ePieceColors _colorToMove;
+
+  ///
+  /// _kingSquare is the square of the king of the side to move, GameState::eNoSquare if there is none.
+  ///
+  squareType _kingSquare;
+
+  ///
+  /// _checkers holds the squares of the enemy pieces checking the king.
+  ///
+  bitBoardType _checkers;
+
+  ///
+  /// _checkMask holds the squares a piece other than the king has to move to in order to answer a check, every square if there is no check.
+  ///
+  bitBoardType _checkMask;
+
+  ///
+  /// _pinned holds the squares of the own pieces that are pinned against the king.
+  ///
+  bitBoardType _pinned;
+};
+
+#endif // LEGALMOVEGENERATOR_H
@@ -11,128 +11,76 @@
 
 #include "MoveGenerator.h"
 #include "TurnManager.h"
-#include "Cell.h"
-#include "Piece.h"
+#include "TurnTracer.h"
 
-int MoveGenerator::_moveStrategy = 2;
-bool MoveGenerator::_reverseIterateThroughPieces = true;
+#include <QMetaType>
 
-MoveGenerator::MoveGenerator(QObject* parent) : QObject(parent)
+MoveGenerator::MoveGenerator(QObject* parent) :
+  QObject(parent),
+  _aiPlayer(),
+  _theGameBoard(0),
+  _table(),
+  _search(_table, this),
+  _searchNumber(0)
 {
-
+  // The move found crosses from the search thread to the GUI thread, so it has to be queued
+  qRegisterMetaType<boardMoveType>("boardMoveType");
+  connect(this, SIGNAL(moveFound(boardMoveType, int)), this, SLOT(playMove(boardMoveType, int)), Qt::QueuedConnection);
 }
 
 MoveGenerator::~MoveGenerator()
 {
-
+  _search.stop();
+  _search.wait();
 }
 
 void MoveGenerator::handleTurnChange(QSharedPointer<Player>& itIsNowThisPlayersTurn,
                                      boardCoordinatesType& containerOfPossibleMoves,
                                      bool kingIsChecked)
 {
+  TRACE_SCOPE("MoveGenerator::handleTurnChange");
+
+  Q_UNUSED(containerOfPossibleMoves);
+  Q_UNUSED(kingIsChecked);
+
+  // Whatever was being searched is no longer the position on the Board
+  _search.stop();
+  _search.wait();
+  ++_searchNumber;
+
   if (itIsNowThisPlayersTurn->identity() == _aiPlayer->identity()) {
-    if (_moveStrategy == 2) {
-      moveWithPriorityForAttack(itIsNowThisPlayersTurn, containerOfPossibleMoves, kingIsChecked);
-    }
-    else if (_moveStrategy == 4) {
-      moveAnyPieceThatCanMove(itIsNowThisPlayersTurn, containerOfPossibleMoves, kingIsChecked);
-    }
-
-    if (_moveStrategy != 4) {
-      _moveStrategy += 2;
-    }
-    else {
-      _moveStrategy = 2;
-    }
+    SearchLimits limits;
+    limits.moveTime = eThinkingTime;
+
+    TRACE_ASYNC_BEGIN("AI search", _searchNumber);
+    _search.setPosition(Board::workingBoardStateMap(), _aiPlayer->associatedColor(), Board::gameHistory());
+    _search.go(limits);
   }
 }
 
-void MoveGenerator::handleMoveCompletionRequired()
+void MoveGenerator::iterationCompleted(const SearchReport& report)
 {
-  if (!_containerForMoving.isEmpty()) {
-    if (_locationEnd.first <= 0 || _locationEnd.first > 8 ||
-        _locationEnd.second <= 0 || _locationEnd.second > 8) {
-      _locationEnd = *(_containerForMoving.begin());
-    }
-    _theGameBoard->toggleCell(_theGameBoard->getCell(_locationEnd));
-    _locationEnd = boardCoordinateType();
-  }
+  Q_UNUSED(report);
 }
 
-void MoveGenerator::moveTheFirstPieceThatCanMove(QSharedPointer<Player>& itIsNowThisPlayersTurn,
-                                                 boardCoordinatesType& containerOfPossibleMoves,
-                                                 bool kingIsChecked,
-                                                 bool priorityForAttack)
+void MoveGenerator::searchCompleted(const boardMoveType& bestMove, const boardMoveType& ponderMove)
 {
-  bool kingChecked = kingIsChecked;
-
-  if (priorityForAttack) { // first try to attack
-    if (MoveMapper::getInstance().doesPlayerHaveAvailableMoves(itIsNowThisPlayersTurn,
-                                                               containerOfPossibleMoves,
-                                                               &kingChecked,
-                                                               _locationStart,
-                                                               _reverseIterateThroughPieces,
-                                                               true)) {
-      _locationEnd = *(containerOfPossibleMoves.begin());
-    } // if no attack moves are available, move any piece
-    else if (MoveMapper::getInstance().doesPlayerHaveAvailableMoves(itIsNowThisPlayersTurn,
-                                                                    containerOfPossibleMoves,
-                                                                    &kingChecked,
-                                                                    _locationStart,
-                                                                    _reverseIterateThroughPieces,
-                                                                    false)) {
-      _locationEnd = *(containerOfPossibleMoves.begin());
-    }
-    else {
-      // END GAME!
-    }
-  }
-  else { // just move any piece without trying to attack
-    if (MoveMapper::getInstance().doesPlayerHaveAvailableMoves(itIsNowThisPlayersTurn,
-                                                               containerOfPossibleMoves,
-                                                               &kingChecked,
-                                                               _locationStart,
-                                                               _reverseIterateThroughPieces,
-                                                               false)) {
-      _locationEnd = *(containerOfPossibleMoves.begin());
-    }
-    else {
-      // END GAME!
-    }
-  }
-
+  Q_UNUSED(ponderMove);
 
-  if (containerOfPossibleMoves.isEmpty()) {
-    _theGameBoard->clearHighLights();
-    _theGameBoard->uncheckAllCheckedCells();
-  }
-  else {
-    _theGameBoard->highLightCoordinates(containerOfPossibleMoves);
-    // select the first move and go for it.
-    _containerForMoving = containerOfPossibleMoves;
-    _theGameBoard->toggleCell(_theGameBoard->getCell(_locationStart));
-  }
-  _reverseIterateThroughPieces = !_reverseIterateThroughPieces;
+  emit moveFound(bestMove, _searchNumber);
 }
 
-void MoveGenerator::moveWithPriorityForAttack(QSharedPointer<Player>& itIsNowThisPlayersTurn,
-                                              boardCoordinatesType& containerOfPossibleMoves,
-                                              bool kingIsChecked)
+void MoveGenerator::playMove(boardMoveType move, int searchNumber)
 {
-  moveTheFirstPieceThatCanMove(itIsNowThisPlayersTurn,
-                               containerOfPossibleMoves,
-                               kingIsChecked,
-                               true);
-}
+  TRACE_SCOPE("MoveGenerator::playMove");
+  TRACE_ASYNC_END("AI search", searchNumber);
 
-void MoveGenerator::moveAnyPieceThatCanMove(QSharedPointer<Player>& itIsNowThisPlayersTurn,
-                                            boardCoordinatesType& containerOfPossibleMoves,
-                                            bool kingIsChecked)
-{
-  moveTheFirstPieceThatCanMove(itIsNowThisPlayersTurn,
-                               containerOfPossibleMoves,
-                               kingIsChecked);
+  // Found for a turn that has passed, e.g. when a new game was started while the AI was thinking
+  if (searchNumber != _searchNumber || TurnManager::currentPlayer()->identity() != _aiPlayer->identity()) {
+    return;
+  }
+
+  _theGameBoard->playMove(move);
 }
 
 Board* MoveGenerator::associatedGameBoard() const
@@ -11,36 +11,50 @@
 
 #include "Player.h"
 #include "Board.h"
+#include "Search.h"
+#include "TranspositionTable.h"
 
 #include <QObject>
 
 ///
-/// The MoveGenerator class is a simple AI class that generates moves for an associated Player instance.
+/// The MoveGenerator class is the AI, it finds the moves of an associated Player instance and plays them on the game Board.
 ///
-class MoveGenerator : public QObject
+/// The moves are found by a Search, which runs in a thread of its own, so that the GUI stays responsive
+/// while the AI thinks, and the human Player may queue premoves meanwhile.  The move found is handed back
+/// to the GUI thread by a queued signal, and played there with Board::playMove().  A search of a position
+/// that has been left since, e.g. because a new game was started, is stopped and its move passed over.
+///
+class MoveGenerator : public QObject, public SearchListener
 {
 
   Q_OBJECT
 
 public:
 
-    ///
-    /// MoveGenerator is the default constructor for objects of the MoveGenerator class.
-    ///
-    /// \param parent is the QObject that will eventually destroy the pointer to MoveGenerator (if not null).
-    ///
+  ///
+  /// The eConstants enum houses the limits the AI thinks within.
+  ///
+  enum eConstants {
+    eThinkingTime = 400 ///< enum value eThinkingTime is the time the AI thinks about a move, in milliseconds.
+  };
+
+  ///
+  /// MoveGenerator is the default constructor for objects of the MoveGenerator class.
+  ///
+  /// \param parent is the QObject that will eventually destroy the pointer to MoveGenerator (if not null).
+  ///
   explicit MoveGenerator(QObject* parent = 0);
 
-    ///
-    /// ~MoveGenerator is the default destructor for objects of type MoveGenerator.
-    ///
+  ///
+  /// ~MoveGenerator is the default destructor for objects of type MoveGenerator.  It stops the search, and waits for it.
+  ///
   virtual ~MoveGenerator();
 
-    ///
-    /// aiPlayer is an accessor method to the AI Player associated with this MoveGenerator instance.
-    ///
-    /// \return the currently associated AI Player for this MoveGenerator instance.
-    ///
+  ///
+  /// aiPlayer is an accessor method to the AI Player associated with this MoveGenerator instance.
+  ///
+  /// \return the currently associated AI Player for this MoveGenerator instance.
+  ///
   QSharedPointer<Player> aiPlayer() const;
 
   ///
@@ -63,10 +77,35 @@ public:
   ///
   void associateGameBoard(Board* associatedGameBoard);
 
+  ///
+  /// iterationCompleted is called from the search thread each time the Search completes an iteration.  Nothing is done with it.
+  ///
+  /// \param report [in] describes the iteration.
+  ///
+  virtual void iterationCompleted(const SearchReport& report);
+
+  ///
+  /// searchCompleted is called from the search thread once the Search has stopped, and hands the move found to the GUI thread.
+  ///
+  /// \param bestMove [in] the move to play.
+  /// \param ponderMove [in] the reply expected, not used.
+  ///
+  virtual void searchCompleted(const boardMoveType& bestMove, const boardMoveType& ponderMove);
+
+signals:
+
+  ///
+  /// moveFound is emitted from the search thread when the Search has found a move.
+  ///
+  /// \param move is the move found.
+  /// \param searchNumber is the number of the search that found it.
+  ///
+  void moveFound(boardMoveType move, int searchNumber);
+
 public slots:
 
   ///
-  /// handleTurnChange is the function that gets invoked when it is the AI's turn to move.
+  /// handleTurnChange is the function that gets invoked when the turn changes, it starts a search if it is the AI's turn to move.
   ///
   /// \param itIsNowThisPlayersTurn indicates whose turn it is to move.
   /// \param containerOfPossibleMoves is a container of moves that proves a move can be made.
@@ -76,12 +115,18 @@ public slots:
                         boardCoordinatesType& containerOfPossibleMoves,
                         bool kingIsChecked);
 
+private slots:
+
   ///
-  /// handleMoveCompletionRequired is called after a move has been initiated, in order to complete the move.
+  /// playMove plays the move found by a search on the game Board, on the GUI thread.
   ///
-  void handleMoveCompletionRequired();
+  /// \param move is the move found.
+  /// \param searchNumber is the number of the search that found it, the move is passed over if it is not the last search started.
+  ///
+  void playMove(boardMoveType move, int searchNumber);
 
 private:
+
   ///
   /// _aiPlayer is a shared pointer type that stores an instance of the AI Player created by Chess.
   ///
@@ -97,66 +142,21 @@ private:
   Board* _theGameBoard;
 
   ///
-  /// _locationStart the location where the AI Player will begin its next move.
-  ///
-  boardCoordinateType _locationStart;
-
-  ///
-  /// _locationEnd the location where the AI Player will move to from _locationStart.
-  ///
-  boardCoordinateType _locationEnd;
-
-  ///
-  /// _containerForMoving contains only valid moves at the time the AI Player needs to move, as it can then just grab a move from the container.
+  /// _table is the private member that stores what the searches found, kept from one move to the next.
   ///
-  boardCoordinatesType _containerForMoving;
+  TranspositionTable _table;
 
   ///
-  /// _moveStrategy just an integer used in a simple round-robin method of determining how to make the next move.
-  ///
-  static int _moveStrategy;
-
-  ///
-  /// _reverseIterateThroughPieces is a boolean that indicates whether to iterate through moves from the back or front of the containers.
-  ///
-  /// It randomizes piece and move selection somewhat.
-  ///
-  static bool _reverseIterateThroughPieces;
-
-  ///
-  /// moveTheFirstPieceThatCanMove does as its name suggests.  In some cases, priority is given to moves that can capture enemy pieces.
-  ///
-  /// \param itIsNowThisPlayersTurn is the Player whose turn it is to play.
-  /// \param containerOfPossibleMoves is a container used for keeping track of what is possible.
-  /// \param kingIsChecked is an indication of whether moves will be restricted to that which will uncheck the king.
-  /// \param priorityForAttack is an indication of whether priority is to capture an enemy piece or not.
-  ///
-  void moveTheFirstPieceThatCanMove(QSharedPointer<Player>& itIsNowThisPlayersTurn,
-                                    boardCoordinatesType& containerOfPossibleMoves,
-                                    bool kingIsChecked,
-                                    bool priorityForAttack = false);
-
-  ///
-  /// moveWithPriorityForAttack wrapper to call moveTheFirstPieceThatCanMove with priority given to moves that can capture enemy pieces.
-  ///
-  /// \param itIsNowThisPlayersTurn is the Player whose turn it is.
-  /// \param containerOfPossibleMoves is a container used for keeping track of what is possible.
-  /// \param kingIsChecked is an indication of whether moves will be restricted to that which will uncheck the king.
+  /// _search is the private member that finds the moves of the AI Player, in a thread of its own.
   ///
-  void moveWithPriorityForAttack(QSharedPointer<Player>& itIsNowThisPlayersTurn,
-                                 boardCoordinatesType& containerOfPossibleMoves,
-                                 bool kingIsChecked);
+  Search _search;
 
   ///
-  /// moveAnyPieceThatCanMove wrapper to call moveTheFirstPieceThatCanMove without priority given to moves that can capture enemy pieces.
+  /// _searchNumber is the private member that counts the turns changed, so a move found for a turn past is recognised.
   ///
-  /// \param itIsNowThisPlayersTurn is the Player whose turn it is.
-  /// \param containerOfPossibleMoves is a container used for keeping track of what is possible.
-  /// \param kingIsChecked is an indication of whether moves will be restricted to that which will uncheck the king.
+  /// It only changes while no search runs, so the search thread may read it.
   ///
-  void moveAnyPieceThatCanMove(QSharedPointer<Player>& itIsNowThisPlayersTurn,
-                               boardCoordinatesType& containerOfPossibleMoves,
-                               bool kingIsChecked);
+  int _searchNumber;
 };
 
 #endif // MOVEGENERATOR_H
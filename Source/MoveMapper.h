@@ -11,6 +11,7 @@
 
 #include "Player.h"
 #include "Board.h"
+#include "LegalMoveGenerator.h"
 
 #include <QObject>
 
@@ -48,20 +49,47 @@ public:
   ///
   /// doesPlayerHaveAvailableMoves calculates every possible move of every piece for a given Player.
   ///
+  /// The legal moves of the Player are kept, see legalMoves(), so the clicks that follow during the turn need not
+  /// generate them again.
+  ///
   /// \param whichPlayer is the Player that the calculation will be done for.
   /// \param containerOfAvailableMoves [in,out] is the container of moves available, post analysis.
   /// \param kingChecked [out] is a boolean that indicates whether the Player referenced by whichPlayer's king is checked.
   /// \param locationStart [out] is a boardCoordinateType that tells you the location of the piece whose valid moves are in containerOfAvailableMoves.
   /// \param reverseIterate is a boolean that indicates whether containers will be accessed from the back or the front.
-  /// \param priorityForAttack is a boolean that indicates whether or not priority should be given to attack enemy pieces.
   /// \return true if moves are available, false if no moves are available to the Player.
   ///
   bool doesPlayerHaveAvailableMoves(QSharedPointer<Player>& whichPlayer,
                                     boardCoordinatesType& containerOfAvailableMoves,
                                     bool* kingChecked,
                                     boardCoordinateType& locationStart,
-                                    bool reverseIterate = false,
-                                    bool priorityForAttack = false);
+                                    bool reverseIterate = false);
+
+  ///
+  /// legalMoves gives every legal move of a colour in a board state, indexed by the square the moves start from.
+  ///
+  /// The moves are generated once and kept until they are asked for with a different state or colour, so all
+  /// requests during a turn (the end-game check when the turn starts, every click of the human Player) share
+  /// a single generation.
+  ///
+  /// \param stateToUse [in] is the board state to generate the moves in.
+  /// \param color [in] is the colour to generate the moves for.
+  /// \return the table of legal moves, valid until the next call.
+  ///
+  const LegalMoveTable& legalMoves(const boardStateMapType& stateToUse, PieceColors::ePieceColors color);
+
+  ///
+  /// isLegalMove determines whether a single move is legal, as looked up in legalMoves().
+  ///
+  /// Once the legal moves of the state are kept, this is a test of a single bit, cheap enough to validate
+  /// a move queued earlier the moment the position it is to be played in comes up.
+  ///
+  /// \param move [in] is the move, from (first) and to (second).
+  /// \param stateToUse [in] is the board state the move is to be played in.
+  /// \param color [in] is the colour of the side to move.
+  /// \return true if the move is legal, false if not, or if either coordinate lies off the board.
+  ///
+  bool isLegalMove(const boardMoveType& move, const boardStateMapType& stateToUse, PieceColors::ePieceColors color);
 
   ///
   /// associatedGameBoard is an accessor method to the Board pointer currently assiated with this instance of MoveMapper.
@@ -100,6 +128,21 @@ private:
   /// _theGameBoard is the private member where a pointer to the game Board is stored.
   ///
   Board* _theGameBoard;
+
+  ///
+  /// _legalMoves is the private member that stores the legal moves last generated by legalMoves().
+  ///
+  LegalMoveTable _legalMoves;
+
+  ///
+  /// _legalMovesState is the private member that stores the board state _legalMoves was generated for.
+  ///
+  GameState _legalMovesState;
+
+  ///
+  /// _legalMovesValid is the private member that indicates whether _legalMoves has been generated at all.
+  ///
+  bool _legalMovesValid;
 };
 
 #endif // MOVEMAPPER_H
@@ -0,0 +1,277 @@
+///
+/// \file   MovePicker.cpp
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This file contains the inner management features of the MovePicker class.
+///
+/// In this cpp file is housed the staged generation of moves.  Every stage is only
+/// generated when the caller asks for a move beyond the previous stage, so a caller
+/// that finds what it is looking for amongst the captures never pays for mapping
+/// the quiet moves of the position.
+///
+
+#include "MovePicker.h"
+
+#include <algorithm>
+
+namespace
+{
+  ///
+  /// scoredMoveType pairs a move with the score used to order it.
+  ///
+  typedef QPair < int, boardMoveType > scoredMoveType;
+
+  ///
+  /// isScoredHigher orders scored moves from the highest to the lowest score.
+  ///
+  bool isScoredHigher(const scoredMoveType& a, const scoredMoveType& b)
+  {
+    return a.first > b.first;
+  }
+}
+
+MovePicker::MovePicker(boardStateMapType& stateToPickFrom,
+                       PieceColors::ePieceColors colorToMove,
+                       const boardMoveType& hashMove,
+                       const boardMovesType& killerMoves,
+                       bool reverseIterate) :
+  _state(stateToPickFrom),
+  _colorToMove(colorToMove),
+  _generator(stateToPickFrom, colorToMove),
+  _hashMove(hashMove),
+  _killerMoves(killerMoves),
+  _reverseIterate(reverseIterate),
+  _skipQuietMoves(false),
+  _stage(eHashMove),
+  _moves(),
+  _index(0)
+{
+
+}
+
+MovePicker::~MovePicker()
+{
+
+}
+
+bool MovePicker::nextMove(boardMoveType& move)
+{
+  while (_stage != eDone) {
+    switch (_stage) {
+    case eHashMove:
+      _stage = eGenerateCaptures;
+      if (_hashMove != boardMoveType() && isLegal(_hashMove)) {
+        move = _hashMove;
+        return true;
+      }
+      break;
+
+    case eGenerateCaptures:
+      generateMoves(true);
+      _stage = eCaptures;
+      break;
+
+    case eCaptures:
+      while (_index < _moves.size()) {
+        move = _moves.at(_index++);
+        if (move != _hashMove) {
+          return true;
+        }
+      }
+      _stage = _skipQuietMoves ? eDone : eKillers;
+      _index = 0;
+      break;
+
+    case eKillers:
+      while (_index < _killerMoves.size()) {
+        move = _killerMoves.at(_index++);
+        if (move != _hashMove && !isTactical(move) && isLegal(move)) {
+          return true;
+        }
+      }
+      _stage = eGenerateQuiets;
+      break;
+
+    case eGenerateQuiets:
+      generateMoves(false);
+      _stage = eQuiets;
+      break;
+
+    case eQuiets:
+      while (_index < _moves.size()) {
+        move = _moves.at(_index++);
+        if (!isAlreadyHandedOut(move)) {
+          return true;
+        }
+      }
+      _stage = eDone;
+      break;
+
+    case eDone:
+      break;
+    }
+  }
+  return false;
+}
+
+void MovePicker::skipQuietMoves()
+{
+  _skipQuietMoves = true;
+  if (_stage > eCaptures) {
+    _stage = eDone;
+  }
+}
+
+MovePicker::eStages MovePicker::stage() const
+{
+  return _stage;
+}
+
+bool MovePicker::isCapture(const boardMoveType& move) const
+{
+  if (_state.value(move.second).second == PieceColors::flipColor(_colorToMove)) {
+    return true;
+  }
+
+  // A pawn moving onto the square passed over by the pawn that just moved two rows takes it en passant
+  squareType enPassantSquare = _state.enPassantSquare();
+  return enPassantSquare != GameState::eNoSquare &&
+         _state.value(move.first).first == Pieces::Identities::ePawn &&
+         BitBoards::square(move.second) == enPassantSquare;
+}
+
+bool MovePicker::isTactical(const boardMoveType& move) const
+{
+  if (move.promotion != Pieces::Identities::eNone) {
+    return move.promotion == Pieces::Identities::eQueen;
+  }
+  return isCapture(move);
+}
+
+int MovePicker::pieceValue(Pieces::Identities::eIdentities identity)
+{
+  switch (identity) {
+  case Pieces::Identities::ePawn   :
+    return 1;
+  case Pieces::Identities::eKnight :
+  case Pieces::Identities::eBishop :
+    return 3;
+  case Pieces::Identities::eCastle :
+    return 5;
+  case Pieces::Identities::eQueen  :
+    return 9;
+  case Pieces::Identities::eKing   :
+    return 100;
+  default                          :
+    return 0;
+  }
+}
+
+bool MovePicker::isLegal(const boardMoveType& move) const
+{
+  // Moves handed in by the caller may be stale, or even off the board
+  if (!_state.contains(move.first) ||
+      move.second.first < 1 || move.second.first > 8 || move.second.second < 1 || move.second.second > 8) {
+    return false;
+  }
+
+  bitBoardType destinations = _generator.destinationsFrom(BitBoards::square(move.first));
+  bitBoardType destination = BitBoards::squareBit(BitBoards::square(move.second));
+  if ((destinations & destination) == 0) {
+    return false;
+  }
+
+  // A pawn reaching the last row has to be promoted to one of four pieces, any other move promotes nothing
+  bool promotes = _state.value(move.first).first == Pieces::Identities::ePawn &&
+                  (BitBoards::promotionRow(_colorToMove) & destination) != 0;
+  if (!promotes) {
+    return move.promotion == Pieces::Identities::eNone;
+  }
+  return move.promotion == Pieces::Identities::eQueen || move.promotion == Pieces::Identities::eCastle ||
+         move.promotion == Pieces::Identities::eBishop || move.promotion == Pieces::Identities::eKnight;
+}
+
+bool MovePicker::isAlreadyHandedOut(const boardMoveType& move) const
+{
+  return move == _hashMove || _killerMoves.contains(move);
+}
+
+void MovePicker::generateMoves(bool captures)
+{
+  _moves.clear();
+  _index = 0;
+
+  QList < scoredMoveType > scoredMoves;
+  bitBoardType enemies = _state.pieces(PieceColors::flipColor(_colorToMove));
+  bitBoardType pieces = _state.pieces(_colorToMove);
+
+  // Pawns also capture on the square passed over by a pawn that just moved two rows
+  bitBoardType enPassant = 0;
+  if (_state.enPassantSquare() != GameState::eNoSquare) {
+    enPassant = BitBoards::squareBit(_state.enPassantSquare());
+  }
+  bitBoardType promotionRow = BitBoards::promotionRow(_colorToMove);
+
+  while (pieces) {
+    squareType from = _reverseIterate ? BitBoards::highestSquare(pieces) : BitBoards::lowestSquare(pieces);
+    pieces &= ~BitBoards::squareBit(from);
+
+    boardCoordinateType location = BitBoards::coordinate(from);
+    definedPieceType    piece    = _state.pieceOn(from);
+
+    bitBoardType victims = piece.first == Pieces::Identities::ePawn ? enemies | enPassant : enemies;
+    bitBoardType destinations = _generator.destinationsFrom(from);
+
+    // Promotions go with the tactical or the quiet moves by the piece promoted to, rather than by whether they capture
+    if (piece.first == Pieces::Identities::ePawn && (destinations & promotionRow)) {
+      bitBoardType promotions = destinations & promotionRow;
+      destinations &= ~promotionRow;
+
+      while (promotions) {
+        boardCoordinateType destination = BitBoards::coordinate(BitBoards::popLowestSquare(promotions));
+
+        if (captures) {
+          // The Queen gained counts along with the victim, if there is one
+          int gain = pieceValue(_state.value(destination).first) +
+                     pieceValue(Pieces::Identities::eQueen) - pieceValue(Pieces::Identities::ePawn);
+          int score = gain * 100 - pieceValue(Pieces::Identities::ePawn);
+          scoredMoves.append(scoredMoveType(score, boardMoveType(location, destination, Pieces::Identities::eQueen)));
+        }
+        else {
+          _moves.append(boardMoveType(location, destination, Pieces::Identities::eKnight));
+          _moves.append(boardMoveType(location, destination, Pieces::Identities::eCastle));
+          _moves.append(boardMoveType(location, destination, Pieces::Identities::eBishop));
+        }
+      }
+    }
+    destinations &= captures ? victims : ~victims;
+
+    while (destinations) {
+      boardCoordinateType destination = BitBoards::coordinate(BitBoards::popLowestSquare(destinations));
+
+      if (captures) {
+        // Most valuable victim first, least valuable attacker breaks the tie.
+        Pieces::Identities::eIdentities victim = _state.value(destination).first;
+        if (victim == Pieces::Identities::eNone) { // en passant
+          victim = Pieces::Identities::ePawn;
+        }
+        int score = pieceValue(victim) * 100 - pieceValue(piece.first);
+        scoredMoves.append(scoredMoveType(score, boardMoveType(location, destination)));
+      }
+      else {
+        _moves.append(boardMoveType(location, destination));
+      }
+    }
+  }
+
+  if (captures) {
+    std::stable_sort(scoredMoves.begin(), scoredMoves.end(), isScoredHigher);
+
+    QList < scoredMoveType >::iterator i = scoredMoves.begin();
+    while (i != scoredMoves.end()) {
+      _moves.append((*i).second);
+      ++i;
+    }
+  }
+}
@@ -0,0 +1,203 @@
+///
+/// \file   MovePicker.h
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This file contains structure definitions and members of the MovePicker class.
+///
+
+#ifndef MOVEPICKER_H
+#define MOVEPICKER_H
+
+#include "CommonTypeDefinitions.h"
+#include "LegalMoveGenerator.h"
+
+///
+/// The MovePicker class hands out the moves of one side in stages, generating each stage only when it is reached.
+///
+/// The order in which moves are handed out is:
+/// * the hash move, i.e. the move the caller believes to be best (for instance from a transposition table),
+/// * captures and promotions to a Queen, most valuable victim first and least valuable attacker first,
+/// * killer moves, quiet moves the caller remembers as having been good in a similar position,
+/// * all remaining quiet moves, promotions to a Knight, Castle or Bishop included.
+///
+/// Callers that are satisfied with an early move simply stop asking, so that the quiet moves of most
+/// positions are never generated at all.  The moves handed out are legal, as they come from a
+/// LegalMoveGenerator; moves supplied by the caller that are not legal in the position are skipped.
+///
+/// Example usage:
+/// \code
+///  MovePicker picker(state, PieceColors::eBlack);
+///  boardMoveType move;
+///  while (picker.nextMove(move)) {
+///    if (isTheMoveGoodEnough(move)) {
+///      break; // later stages are never generated
+///    }
+///  }
+/// \endcode
+///
+class MovePicker
+{
+
+public:
+
+  ///
+  /// The eStages enum lists the stages a MovePicker goes through, in order.
+  ///
+  enum eStages {
+    eHashMove,         ///< enum value eHashMove is the stage where the move supplied by the caller is handed out.
+    eGenerateCaptures, ///< enum value eGenerateCaptures is the stage where captures are generated and ordered.
+    eCaptures,         ///< enum value eCaptures is the stage where the generated captures are handed out.
+    eKillers,          ///< enum value eKillers is the stage where the killer moves supplied by the caller are handed out.
+    eGenerateQuiets,   ///< enum value eGenerateQuiets is the stage where the remaining quiet moves are generated.
+    eQuiets,           ///< enum value eQuiets is the stage where the generated quiet moves are handed out.
+    eDone              ///< enum value eDone indicates that every stage has been exhausted.
+  };
+
+  ///
+  /// MovePicker is the constructor for objects of the MovePicker class.
+  ///
+  /// \param stateToPickFrom [in] is the board state whose moves will be handed out.  It must outlive the MovePicker.
+  /// \param colorToMove [in] is the colour of the pieces whose moves will be handed out.
+  /// \param hashMove [in] is the move to hand out first, if it is possible in stateToPickFrom.  A default constructed move means "none".
+  /// \param killerMoves [in] are quiet moves to hand out ahead of the other quiet moves, if they are possible in stateToPickFrom.
+  /// \param reverseIterate [in] indicates whether pieces are visited from the back or the front of the state map.
+  ///
+  MovePicker(boardStateMapType& stateToPickFrom,
+             PieceColors::ePieceColors colorToMove,
+             const boardMoveType& hashMove = boardMoveType(),
+             const boardMovesType& killerMoves = boardMovesType(),
+             bool reverseIterate = false);
+
+  ///
+  /// ~MovePicker is the default destructor for objects of type MovePicker.
+  ///
+  virtual ~MovePicker();
+
+  ///
+  /// nextMove hands out the next move, advancing (and generating) stages as needed.
+  ///
+  /// \param move [out] is the next move, only valid when true is returned.
+  /// \return true if a move was handed out, false if all stages are exhausted.
+  ///
+  bool nextMove(boardMoveType& move);
+
+  ///
+  /// skipQuietMoves restricts the MovePicker to the hash move and captures, for callers that only want captures.
+  ///
+  void skipQuietMoves();
+
+  ///
+  /// stage is an accessor method to the stage the MovePicker is currently in.
+  ///
+  /// \return the current stage.
+  ///
+  eStages stage() const;
+
+  ///
+  /// isCapture determines whether a move lands on an enemy piece in the state the MovePicker was created for.
+  ///
+  /// \param move [in] is the move to test.
+  /// \return true if the move captures an enemy piece, en passant included, false if not.
+  ///
+  bool isCapture(const boardMoveType& move) const;
+
+  ///
+  /// isTactical determines whether a move is handed out along with the captures, i.e. captures or promotes to a Queen.
+  ///
+  /// Such moves are not worth remembering as killer moves, as they are tried early anyway.
+  ///
+  /// \param move [in] is the move to test.
+  /// \return true if the move is a capture, other than one that promotes to another piece than a Queen, or a promotion to a Queen.
+  ///
+  bool isTactical(const boardMoveType& move) const;
+
+  ///
+  /// pieceValue gives the conventional material value of a piece identity, used to order captures.
+  ///
+  /// \param identity [in] is the identity of the piece.
+  /// \return the value of the piece, in pawns.
+  ///
+  static int pieceValue(Pieces::Identities::eIdentities identity);
+
+private:
+
+  ///
+  /// _state is the board state whose moves are handed out.
+  ///
+  boardStateMapType& _state;
+
+  ///
+  /// _colorToMove is the colour of the pieces whose moves are handed out.
+  ///
+  PieceColors::ePieceColors _colorToMove;
+
+  ///
+  /// _generator is the generator of the legal moves of _colorToMove in _state.
+  ///
+  LegalMoveGenerator _generator;
+
+  ///
+  /// _hashMove is the move handed out during the eHashMove stage.
+  ///
+  boardMoveType _hashMove;
+
+  ///
+  /// _killerMoves are the moves handed out during the eKillers stage.
+  ///
+  boardMovesType _killerMoves;
+
+  ///
+  /// _reverseIterate indicates whether pieces are visited from the back or the front of the state map.
+  ///
+  bool _reverseIterate;
+
+  ///
+  /// _skipQuietMoves indicates whether the picker stops after the captures.
+  ///
+  bool _skipQuietMoves;
+
+  ///
+  /// _stage is the stage the MovePicker is currently in.
+  ///
+  eStages _stage;
+
+  ///
+  /// _moves holds the moves generated for the current stage.
+  ///
+  boardMovesType _moves;
+
+  ///
+  /// _index is the position in _moves (or _killerMoves) of the next move to hand out.
+  ///
+  int _index;
+
+  ///
+  /// isLegal determines whether a move supplied by the caller can be played by _colorToMove in _state.
+  ///
+  /// \param move [in] is the move to test.
+  /// \return true if a piece of the right colour can legally make the move, and it names a promotion if and only if
+  ///         it promotes, false if not.
+  ///
+  bool isLegal(const boardMoveType& move) const;
+
+  ///
+  /// isAlreadyHandedOut determines whether a move was handed out during the eHashMove or eKillers stages.
+  ///
+  /// \param move [in] is the move to test.
+  /// \return true if the move was handed out ahead of its natural stage.
+  ///
+  bool isAlreadyHandedOut(const boardMoveType& move) const;
+
+  ///
+  /// generateMoves maps either the tactical moves or the quiet moves of every piece of _colorToMove into _moves.
+  ///
+  /// A pawn reaching the last row is promoted to a Queen with the tactical moves, and to a Knight, Castle and Bishop
+  /// with the quiet moves, whether it captures or not.
+  ///
+  /// \param captures [in] is true to generate the tactical moves, false to generate the quiet moves.
+  ///
+  void generateMoves(bool captures);
+};
+
+#endif // MOVEPICKER_H
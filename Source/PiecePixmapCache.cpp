@@ -0,0 +1,155 @@
+///
+/// \file   PiecePixmapCache.cpp
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This cpp file contains the body functionality of the PiecePixmapCache class.
+///
+
+#include "PiecePixmapCache.h"
+
+#include <QCoreApplication>
+#include <QPainter>
+#include <QSvgRenderer>
+#include <QWidget>
+
+namespace
+{
+  ///
+  /// eBucketMask keeps the bits of a key that hold the bucket, see PiecePixmapCache::bucketKey().
+  ///
+  const quint64 eBucketMask = Q_UINT64_C(0xFFFFFFFFFFFF);
+}
+
+PiecePixmapCache::PiecePixmapCache() :
+  QObject(0)
+{
+  for (int color = PieceColors::eInit; color <= PieceColors::eMax; ++color) {
+    for (int identity = Pieces::Identities::eInit; identity <= Pieces::Identities::eMax; ++identity) {
+      _renderers[color][identity] = 0;
+    }
+  }
+
+  if (QCoreApplication::instance() != 0) {
+    connect(QCoreApplication::instance(), SIGNAL(aboutToQuit()), this, SLOT(clear()));
+  }
+}
+
+PiecePixmapCache::~PiecePixmapCache()
+{
+
+}
+
+const QPixmap& PiecePixmapCache::pixmap(definedPieceType piece, int size, qreal devicePixelRatio)
+{
+  if (piece.first == Pieces::Identities::eNone || piece.second == PieceColors::eNone) {
+    return _nullPixmap;
+  }
+
+  if (size <= 0) {
+    size = renderer(piece)->defaultSize().width();
+  }
+
+  size = sizeBucket(size);
+  quint64 bucket = bucketKey(size, devicePixelRatio);
+  useBucket(bucket);
+
+  quint64 pixmapKey = key(piece, bucket);
+  QMap<quint64, QPixmap>::const_iterator found = _scaledPixmaps.constFind(pixmapKey);
+  if (found != _scaledPixmaps.constEnd()) {
+    return found.value();
+  }
+
+  // Rendered to the physical pixels of the screen, and drawn at the device independent size
+  int physicalSize = qMax(1, qRound(size * devicePixelRatio));
+  QPixmap rendered(physicalSize, physicalSize);
+  rendered.fill(Qt::transparent);
+
+  QPainter painter(&rendered);
+  painter.setRenderHint(QPainter::Antialiasing);
+  renderer(piece)->render(&painter);
+  painter.end();
+  rendered.setDevicePixelRatio(devicePixelRatio);
+
+  return _scaledPixmaps.insert(pixmapKey, rendered).value();
+}
+
+int PiecePixmapCache::sizeBucket(int size)
+{
+  return qMax(int(eBucketSize), size - size % eBucketSize);
+}
+
+qreal PiecePixmapCache::devicePixelRatio(const QWidget* widget)
+{
+#if QT_VERSION >= QT_VERSION_CHECK(5, 6, 0)
+  return widget->devicePixelRatioF();
+#else
+  return widget->devicePixelRatio();
+#endif
+}
+
+void PiecePixmapCache::clear()
+{
+  for (int color = PieceColors::eInit; color <= PieceColors::eMax; ++color) {
+    for (int identity = Pieces::Identities::eInit; identity <= Pieces::Identities::eMax; ++identity) {
+      delete _renderers[color][identity];
+      _renderers[color][identity] = 0;
+    }
+  }
+
+  _scaledPixmaps.clear();
+  _buckets.clear();
+}
+
+QSvgRenderer* PiecePixmapCache::renderer(definedPieceType piece)
+{
+  QSvgRenderer*& renderer = _renderers[piece.second][piece.first];
+
+  if (renderer == 0) {
+    QString colorString = PieceColors::getInstance().colorNames().at(piece.second);
+    QString identityString = Pieces::getInstance().identityNames().at(piece.first);
+    QString resPath = QString(":/Pieces/") + QString("Resources/") + colorString + QString("/") + identityString + QString(".svg");
+    renderer = new QSvgRenderer(resPath);
+  }
+
+  return renderer;
+}
+
+void PiecePixmapCache::useBucket(quint64 bucket)
+{
+  // Nearly always the bucket used last, or the one of the other widget drawing pieces
+  int index = _buckets.indexOf(bucket);
+  if (index >= 0) {
+    _buckets.move(index, _buckets.size() - 1);
+    return;
+  }
+
+  _buckets.append(bucket);
+  if (_buckets.size() <= eMaxBuckets) {
+    return;
+  }
+
+  quint64 dropped = _buckets.takeFirst();
+  QMap<quint64, QPixmap>::iterator scaled = _scaledPixmaps.begin();
+  while (scaled != _scaledPixmaps.end()) {
+    if ((scaled.key() & eBucketMask) == dropped) {
+      scaled = _scaledPixmaps.erase(scaled);
+    }
+    else {
+      ++scaled;
+    }
+  }
+}
+
+quint64 PiecePixmapCache::bucketKey(int size, qreal devicePixelRatio)
+{
+  // The ratio is kept to two decimals, which tells apart every scale factor desktops offer
+  quint64 ratio = quint64(qRound(devicePixelRatio * 100));
+
+  return (quint64(size & 0xFFFF) << 32) | (ratio & 0xFFFFFFFF);
+}
+
+quint64 PiecePixmapCache::key(definedPieceType piece, quint64 bucket)
+{
+  return (quint64(piece.first) << 56) | (quint64(piece.second) << 48) | (bucket & eBucketMask);
+}
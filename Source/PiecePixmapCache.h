@@ -0,0 +1,182 @@
+///
+/// \file   PiecePixmapCache.h
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This file contains structure definitions and members of the PiecePixmapCache class.
+///
+
+#ifndef PIECEPIXMAPCACHE_H
+#define PIECEPIXMAPCACHE_H
+
+#include "CommonTypeDefinitions.h"
+
+#include <QList>
+#include <QMap>
+#include <QObject>
+#include <QPixmap>
+
+class QWidget;
+class QSvgRenderer;
+
+///
+/// The PiecePixmapCache class holds the images of the pieces for the whole process, rendered once per size.
+///
+/// The pieces are drawn as SVG in the resources.  Every drawing is parsed the first time it is asked for,
+/// and rendered the first time a size of it is asked for, after which the same QPixmap is handed out to
+/// whoever asks again.  Making a move therefore never parses or renders an image.
+///
+/// The images are kept per identity, colour, size bucket and device pixel ratio.  Sizes are rounded down
+/// to a bucket of eBucketSize pixels, so that resizing a window only renders the images again every few
+/// pixels, rather than on every resize event.  Images are rendered to the physical pixels of the screen,
+/// so they stay crisp at any size, on high-DPI screens too.
+///
+/// Only the eMaxBuckets pairs of size bucket and device pixel ratio used last are kept: the board and the
+/// strips of captured pieces each use one at a time, so the sizes a window was resized through are dropped.
+///
+/// The images are dropped when the application is about to quit, as pixmaps may not outlive it.
+///
+/// Example usage:
+/// \code
+///  definedPieceType piece(Pieces::Identities::eKnight, PieceColors::eWhite);
+///  const QPixmap& knight = PiecePixmapCache::getInstance().pixmap(piece, 40);
+/// \endcode
+///
+class PiecePixmapCache : public QObject
+{
+  Q_OBJECT
+
+public:
+
+  ///
+  /// getInstance returns an instance reference, as the constructor is private.  Singleton Pattern.
+  ///
+  /// \return an instance reference to the static object of class PiecePixmapCache.
+  ///
+  static PiecePixmapCache& getInstance()
+  {
+    static PiecePixmapCache instance;
+    return instance;
+  }
+
+  ///
+  /// ~PiecePixmapCache is the default destructor for objects of type PiecePixmapCache.
+  ///
+  virtual ~PiecePixmapCache();
+
+  ///
+  /// The eConstants enum houses the sizes the cache works with.
+  ///
+  enum eConstants {
+    eBucketSize = 4, ///< enum value eBucketSize is the step sizes are rounded down to, in device independent pixels.
+    eMaxBuckets = 4  ///< enum value eMaxBuckets is the number of pairs of size bucket and device pixel ratio kept.
+  };
+
+  ///
+  /// pixmap returns the image of a piece, scaled to fit a square of the given size.
+  ///
+  /// The image is scaled to sizeBucket(size), so it may be up to eBucketSize - 1 pixels smaller than asked for.
+  ///
+  /// \param piece [in] is the identity and colour of the piece.
+  /// \param size [in] is the width and height the image must fit, in device independent pixels, or 0 for the size it is drawn at.
+  /// \param devicePixelRatio [in] is the ratio of the physical to the device independent pixels of the screen shown on.
+  /// \return the image, or a null pixmap if the piece is eNone.  The reference stays valid until another size is
+  ///         asked for, so keep a copy of the QPixmap, which is cheap, to hold on to it.
+  ///
+  const QPixmap& pixmap(definedPieceType piece, int size = 0, qreal devicePixelRatio = 1.0);
+
+  ///
+  /// sizeBucket rounds a size down to the bucket the images of that size are kept in.
+  ///
+  /// \param size [in] is the size, in device independent pixels.
+  /// \return the size of the bucket, at least eBucketSize.
+  ///
+  static int sizeBucket(int size);
+
+  ///
+  /// devicePixelRatio returns the ratio of the physical to the device independent pixels of the screen a widget is on.
+  ///
+  /// \param widget [in] is the widget.
+  /// \return the ratio, which need not be a whole number.
+  ///
+  static qreal devicePixelRatio(const QWidget* widget);
+
+public slots:
+
+  ///
+  /// clear drops every image kept, and is called when the application is about to quit.
+  ///
+  void clear();
+
+private:
+
+  ///
+  /// PiecePixmapCache is the constructor for objects of the PiecePixmapCache class.
+  ///
+  PiecePixmapCache();
+
+  ///
+  /// PiecePixmapCache is the copy constructor for objects of the PiecePixmapCache class.  Private to enforce Singleton.
+  ///
+  PiecePixmapCache(const PiecePixmapCache&);
+
+  ///
+  /// operator = is the assignment operator for objects of the PiecePixmapCache class.  Private to enforce Singleton.
+  ///
+  void operator = (const PiecePixmapCache&);
+
+  ///
+  /// renderer returns the drawing of a piece, parsing it the first time it is asked for.
+  ///
+  /// \param piece [in] is the identity and colour of the piece.
+  /// \return the renderer of the drawing.
+  ///
+  QSvgRenderer* renderer(definedPieceType piece);
+
+  ///
+  /// useBucket marks a bucket as used last, and drops the images of the bucket used longest ago if there are too many.
+  ///
+  /// \param bucket [in] is the bucket, see bucketKey().
+  ///
+  void useBucket(quint64 bucket);
+
+  ///
+  /// bucketKey combines a size bucket and a device pixel ratio into a single value.
+  ///
+  /// \param size [in] is the size bucket, in device independent pixels.
+  /// \param devicePixelRatio [in] is the device pixel ratio.
+  /// \return the key of the bucket, which takes up the lower 48 bits.
+  ///
+  static quint64 bucketKey(int size, qreal devicePixelRatio);
+
+  ///
+  /// key combines everything an image is kept by into a single value.
+  ///
+  /// \param piece [in] is the identity and colour of the piece.
+  /// \param bucket [in] is the bucket of the image, see bucketKey().
+  /// \return the key of the image.
+  ///
+  static quint64 key(definedPieceType piece, quint64 bucket);
+
+  ///
+  /// _renderers is the private member that holds the drawings of the pieces, per colour and identity.
+  ///
+  QSvgRenderer* _renderers[PieceColors::eMax + 1][Pieces::Identities::eMax + 1];
+
+  ///
+  /// _scaledPixmaps is the private member that holds the images of the pieces rendered, by key().
+  ///
+  QMap<quint64, QPixmap> _scaledPixmaps;
+
+  ///
+  /// _buckets is the private member that holds the buckets _scaledPixmaps has images of, the one used last at the back.
+  ///
+  QList<quint64> _buckets;
+
+  ///
+  /// _nullPixmap is the private member returned for a piece that is eNone.
+  ///
+  QPixmap _nullPixmap;
+};
+
+#endif // PIECEPIXMAPCACHE_H
@@ -0,0 +1,562 @@
+///
+/// \file   Search.cpp
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This file contains the inner management features of the Search class.
+///
+/// In this cpp file every move is played out on a copy of the position, as the perft tool does, so
+/// that taking a move back is no more than letting the copy go out of scope.
+///
+
+#include "Search.h"
+#include "Evaluation.h"
+#include "MovePicker.h"
+#include "BitBoards.h"
+
+namespace
+{
+  ///
+  /// eCheckInterval is the number of positions, less one, searched between checks of the time and node limits.
+  ///
+  const qint64 eCheckInterval = 2047;
+
+  ///
+  /// eMoveOverhead is the time kept in reserve for the move to reach the opponent, in milliseconds.
+  ///
+  const qint64 eMoveOverhead = 10;
+
+  ///
+  /// eMovesToPlan is the number of moves the time left is spread over, when no time control is given.
+  ///
+  const int eMovesToPlan = 30;
+
+  ///
+  /// eNullMoveReduction is the number of moves less a position is searched to after passing the move.
+  ///
+  const int eNullMoveReduction = 2;
+
+  ///
+  /// eMateInMaxPly is the lowest score that still means mate, found within eMaxPly moves.
+  ///
+  const int eMateInMaxPly = Search::eMateScore - Search::eMaxPly;
+
+  ///
+  /// toTable turns a mate score, which counts from the root, into one that counts from the position stored.
+  ///
+  inline int toTable(int score, int ply)
+  {
+    return score >= eMateInMaxPly ? score + ply : (score <= -eMateInMaxPly ? score - ply : score);
+  }
+
+  ///
+  /// fromTable turns a mate score stored in the table back into one that counts from the root.
+  ///
+  inline int fromTable(int score, int ply)
+  {
+    return score >= eMateInMaxPly ? score - ply : (score <= -eMateInMaxPly ? score + ply : score);
+  }
+
+  ///
+  /// hasPiecesBesidesPawns determines whether a side has anything but its King and Pawns, below which passing the move is no proof of strength.
+  ///
+  inline bool hasPiecesBesidesPawns(const boardStateMapType& state, PieceColors::ePieceColors color)
+  {
+    return (state.pieces(color) &
+            ~state.pieces(color, Pieces::Identities::ePawn) &
+            ~state.pieces(color, Pieces::Identities::eKing)) != 0;
+  }
+}
+
+SearchLimits::SearchLimits() :
+  movesToGo(0),
+  moveTime(0),
+  depth(0),
+  nodes(0),
+  infinite(false),
+  ponder(false)
+{
+  for (int color = 0; color <= PieceColors::eMax; ++color) {
+    time[color] = 0;
+    increment[color] = 0;
+  }
+}
+
+Search::Search(TranspositionTable& table, SearchListener* listener, QObject* parent) :
+  QThread(parent),
+  _table(table),
+  _listener(listener),
+  _helpers(),
+  _helperIndex(0),
+  _rootState(),
+  _rootColor(PieceColors::eWhite),
+  _history(),
+  _limits(),
+  _optimumTime(0),
+  _maximumTime(0),
+  _timer(),
+  _stopped(0),
+  _pondering(0),
+  _ponderHitTime(0),
+  _nodes(0),
+  _publishedNodes(0),
+  _selectiveDepth(0),
+  _bestMove(),
+  _ponderMove()
+{
+  _timer.start();
+  for (int ply = 0; ply < eMaxPly; ++ply) {
+    _principalVariationLength[ply] = ply;
+  }
+}
+
+Search::~Search()
+{
+  stop();
+  wait();
+  setThreads(1);
+}
+
+void Search::setPosition(const boardStateMapType& state, PieceColors::ePieceColors colorToMove, const GameHistory& history)
+{
+  _rootState = state;
+  _rootColor = colorToMove;
+  _history = history;
+
+  for (int index = 0; index < _helpers.size(); ++index) {
+    _helpers.at(index)->setPosition(state, colorToMove, history);
+  }
+}
+
+void Search::setThreads(int threads)
+{
+  while (_helpers.size() > qMax(threads, 1) - 1) {
+    delete _helpers.takeLast();
+  }
+  while (_helpers.size() < threads - 1) {
+    Search* helper = new Search(_table);
+    helper->_helperIndex = _helpers.size() + 1;
+    helper->setPosition(_rootState, _rootColor, _history);
+    _helpers.append(helper);
+  }
+}
+
+int Search::threads() const
+{
+  return _helpers.size() + 1;
+}
+
+void Search::go(const SearchLimits& limits)
+{
+  _limits = limits;
+  _stopped.storeRelease(0);
+  _pondering.storeRelease(limits.ponder ? 1 : 0);
+  _ponderHitTime.storeRelease(0);
+  _nodes = 0;
+  _publishedNodes.storeRelease(0);
+  _timer.start();
+
+  _optimumTime = 0;
+  _maximumTime = 0;
+  qint64 timeLeft = limits.time[_rootColor];
+
+  if (limits.moveTime > 0) {
+    _optimumTime = qMax(limits.moveTime - eMoveOverhead, qint64(1));
+    _maximumTime = _optimumTime;
+  }
+  else if (timeLeft > 0) {
+    int movesToGo = limits.movesToGo > 0 ? qMin(limits.movesToGo, eMovesToPlan) : eMovesToPlan;
+    qint64 reserve = qMax(timeLeft - eMoveOverhead, qint64(1));
+    _optimumTime = qMin(timeLeft / movesToGo + limits.increment[_rootColor] * 3 / 4, reserve);
+    _maximumTime = qMin(_optimumTime * 4, reserve / 2 > _optimumTime ? reserve / 2 : _optimumTime);
+  }
+
+  start();
+}
+
+void Search::stop()
+{
+  _stopped.storeRelease(1);
+  for (int index = 0; index < _helpers.size(); ++index) {
+    _helpers.at(index)->stop();
+  }
+}
+
+void Search::ponderHit()
+{
+  _ponderHitTime.storeRelease(int(_timer.elapsed()));
+  _pondering.storeRelease(0);
+}
+
+qint64 Search::nodes() const
+{
+  qint64 total = _publishedNodes.loadAcquire();
+  for (int index = 0; index < _helpers.size(); ++index) {
+    total += _helpers.at(index)->nodes();
+  }
+  return total;
+}
+
+boardMoveType Search::bestMove() const
+{
+  return _bestMove;
+}
+
+void Search::run()
+{
+  if (_helperIndex == 0) {
+    _table.newSearch();
+    for (int index = 0; index < _helpers.size(); ++index) {
+      _helpers.at(index)->go(_limits);
+    }
+  }
+
+  iterate();
+  _publishedNodes.storeRelease(_nodes);
+
+  if (_helperIndex != 0) {
+    return;
+  }
+
+  // UCI wants no best move before it said stop, or the move pondered on was played
+  while ((_limits.infinite || _pondering.loadAcquire() != 0) && !isStopped()) {
+    QThread::msleep(1);
+  }
+
+  for (int index = 0; index < _helpers.size(); ++index) {
+    _helpers.at(index)->stop();
+    _helpers.at(index)->wait();
+  }
+
+  // Stopped before the first iteration was complete, any legal move beats none at all
+  if (_bestMove == boardMoveType()) {
+    MovePicker picker(_rootState, _rootColor);
+    picker.nextMove(_bestMove);
+  }
+
+  if (_listener) {
+    _listener->searchCompleted(_bestMove, _ponderMove);
+  }
+}
+
+void Search::iterate()
+{
+  _bestMove = boardMoveType();
+  _ponderMove = boardMoveType();
+  for (int ply = 0; ply < eMaxPly; ++ply) {
+    _killers[ply].clear();
+  }
+
+  // The extra threads start at alternating depths, so that they are not all on the same iteration
+  for (int depth = 1 + _helperIndex % 2; depth < eMaxPly; ++depth) {
+    if (_helperIndex == 0 && _limits.depth > 0 && depth > _limits.depth) {
+      break;
+    }
+
+    _selectiveDepth = 0;
+    boardStateMapType root(_rootState);
+    int score = alphaBeta(root, _rootColor, depth, 0, -eInfinity, eInfinity, false);
+
+    // An iteration cut short is not to be trusted, the previous one stands
+    if (isStopped()) {
+      break;
+    }
+
+    if (_principalVariationLength[0] > 0) {
+      _bestMove = _principalVariation[0][0];
+      _ponderMove = _principalVariationLength[0] > 1 ? _principalVariation[0][1] : boardMoveType();
+    }
+
+    if (_helperIndex != 0) {
+      continue;
+    }
+
+    _publishedNodes.storeRelease(_nodes);
+
+    if (_listener) {
+      SearchReport report;
+      report.depth = depth;
+      report.selectiveDepth = _selectiveDepth;
+      report.score = score;
+      report.nodes = nodes();
+      report.time = _timer.elapsed();
+      report.hashfull = _table.hashfull();
+      for (int ply = 0; ply < _principalVariationLength[0]; ++ply) {
+        report.principalVariation.append(_principalVariation[0][ply]);
+      }
+      _listener->iterationCompleted(report);
+    }
+
+    // Another iteration takes longer than all before it together, so it would not finish in time anyway
+    if (_optimumTime > 0 && _pondering.loadAcquire() == 0 && elapsed() >= _optimumTime / 2) {
+      break;
+    }
+  }
+}
+
+int Search::alphaBeta(boardStateMapType& state,
+                      PieceColors::ePieceColors colorToMove,
+                      int depth,
+                      int ply,
+                      int alpha,
+                      int beta,
+                      bool nullMoveAllowed)
+{
+  if (depth <= 0) {
+    return quiescence(state, colorToMove, ply, alpha, beta);
+  }
+
+  _principalVariationLength[ply] = ply;
+
+  if ((++_nodes & eCheckInterval) == 0) {
+    checkLimits();
+  }
+  if (isStopped()) {
+    return 0;
+  }
+  _selectiveDepth = qMax(_selectiveDepth, ply);
+
+  bool isRoot = ply == 0;
+  bool isPrincipalVariation = beta - alpha > 1;
+
+  if (!isRoot) {
+    if (_history.isRepetition() || _history.isFiftyMoveDraw() || state.isInsufficientMaterial()) {
+      return 0;
+    }
+    if (ply >= eMaxPly - 1) {
+      return Evaluation::evaluate(state, colorToMove);
+    }
+
+    // No line can do better than mating right away, or worse than being mated right away
+    alpha = qMax(alpha, -eMateScore + ply);
+    beta = qMin(beta, eMateScore - ply - 1);
+    if (alpha >= beta) {
+      return alpha;
+    }
+  }
+
+  hashType positionKey = key(state, colorToMove);
+  boardMoveType hashMove;
+  TranspositionTable::Probe probe;
+
+  if (_table.probe(positionKey, probe)) {
+    hashMove = probe.move;
+    int score = fromTable(probe.score, ply);
+
+    if (!isPrincipalVariation && probe.depth >= depth &&
+        (probe.bound == TranspositionTable::eExactBound ||
+         (probe.bound == TranspositionTable::eLowerBound && score >= beta) ||
+         (probe.bound == TranspositionTable::eUpperBound && score <= alpha))) {
+      return score;
+    }
+  }
+
+  // The table is probed with the depth asked for, so that is the depth stored, not the one a check extends it to
+  int nominalDepth = depth;
+  bool inCheck = state.isInCheck(colorToMove);
+  if (inCheck) {
+    ++depth;
+  }
+
+  PieceColors::ePieceColors opponent = PieceColors::flipColor(colorToMove);
+
+  // If passing the move still leaves the opponent worse off than beta, a real move will do even better
+  if (nullMoveAllowed && !inCheck && !isPrincipalVariation && depth > eNullMoveReduction &&
+      hasPiecesBesidesPawns(state, colorToMove) && Evaluation::evaluate(state, colorToMove) >= beta) {
+    boardStateMapType next(state);
+    next.setEnPassantSquare(GameState::eNoSquare);
+    _history.push(next.hash(), true);
+    int score = -alphaBeta(next, opponent, depth - 1 - eNullMoveReduction, ply + 1, -beta, -beta + 1, false);
+    _history.pop();
+
+    if (isStopped()) {
+      return 0;
+    }
+    if (score >= beta) {
+      return score >= eMateInMaxPly ? beta : score;
+    }
+  }
+
+  MovePicker picker(state, colorToMove, hashMove, _killers[ply]);
+  boardMoveType move;
+  boardMoveType bestMove;
+  int bestScore = -eInfinity;
+  int originalAlpha = alpha;
+  int moveCount = 0;
+
+  while (picker.nextMove(move)) {
+    ++moveCount;
+
+    squareType from = BitBoards::square(move.first);
+    bool tactical = picker.isTactical(move);
+    bool pawnMove = state.pieceOn(from).first == Pieces::Identities::ePawn;
+
+    boardStateMapType next(state);
+    definedPieceType taken = next.makeMove(from, BitBoards::square(move.second), move.promotion);
+    _history.push(next.hash(), pawnMove || taken.first != Pieces::Identities::eNone);
+
+    int score;
+    if (moveCount == 1) {
+      score = -alphaBeta(next, opponent, depth - 1, ply + 1, -beta, -alpha, true);
+    }
+    else {
+      // Prove the move is no better than the best so far with a null window, and search it fully if it is
+      score = -alphaBeta(next, opponent, depth - 1, ply + 1, -alpha - 1, -alpha, true);
+      if (score > alpha && score < beta) {
+        score = -alphaBeta(next, opponent, depth - 1, ply + 1, -beta, -alpha, true);
+      }
+    }
+    _history.pop();
+
+    if (isStopped()) {
+      return 0;
+    }
+
+    if (score > bestScore) {
+      bestScore = score;
+
+      if (score > alpha) {
+        alpha = score;
+        bestMove = move;
+        updatePrincipalVariation(ply, move);
+
+        if (alpha >= beta) {
+          if (!tactical) {
+            storeKiller(ply, move);
+          }
+          break;
+        }
+      }
+    }
+  }
+
+  if (moveCount == 0) {
+    return inCheck ? -eMateScore + ply : 0;
+  }
+
+  TranspositionTable::eBounds bound = bestScore >= beta ? TranspositionTable::eLowerBound :
+                                      (bestScore > originalAlpha ? TranspositionTable::eExactBound :
+                                       TranspositionTable::eUpperBound);
+  _table.store(positionKey, bestMove, toTable(bestScore, ply), nominalDepth, bound);
+
+  return bestScore;
+}
+
+int Search::quiescence(boardStateMapType& state, PieceColors::ePieceColors colorToMove, int ply, int alpha, int beta)
+{
+  _principalVariationLength[ply] = ply;
+
+  if ((++_nodes & eCheckInterval) == 0) {
+    checkLimits();
+  }
+  if (isStopped()) {
+    return 0;
+  }
+  _selectiveDepth = qMax(_selectiveDepth, ply);
+
+  if (ply >= eMaxPly - 1) {
+    return Evaluation::evaluate(state, colorToMove);
+  }
+
+  // In check every move is searched, as standing still is not an option
+  bool inCheck = state.isInCheck(colorToMove);
+  int bestScore = -eInfinity;
+
+  if (!inCheck) {
+    bestScore = Evaluation::evaluate(state, colorToMove);
+    if (bestScore >= beta) {
+      return bestScore;
+    }
+    alpha = qMax(alpha, bestScore);
+  }
+
+  MovePicker picker(state, colorToMove);
+  if (!inCheck) {
+    picker.skipQuietMoves();
+  }
+
+  PieceColors::ePieceColors opponent = PieceColors::flipColor(colorToMove);
+  boardMoveType move;
+  int moveCount = 0;
+
+  while (picker.nextMove(move)) {
+    ++moveCount;
+
+    boardStateMapType next(state);
+    next.makeMove(BitBoards::square(move.first), BitBoards::square(move.second), move.promotion);
+    int score = -quiescence(next, opponent, ply + 1, -beta, -alpha);
+
+    if (isStopped()) {
+      return 0;
+    }
+
+    if (score > bestScore) {
+      bestScore = score;
+      if (score > alpha) {
+        alpha = score;
+        if (alpha >= beta) {
+          break;
+        }
+      }
+    }
+  }
+
+  if (inCheck && moveCount == 0) {
+    return -eMateScore + ply;
+  }
+  return bestScore;
+}
+
+void Search::checkLimits()
+{
+  _publishedNodes.storeRelease(_nodes);
+
+  if (_helperIndex != 0) {
+    return;
+  }
+
+  if (_limits.nodes > 0 && nodes() >= _limits.nodes) {
+    stop();
+  }
+
+  if (_maximumTime > 0 && _pondering.loadAcquire() == 0 && elapsed() >= _maximumTime) {
+    stop();
+  }
+}
+
+qint64 Search::elapsed() const
+{
+  return _timer.elapsed() - _ponderHitTime.loadAcquire();
+}
+
+void Search::storeKiller(int ply, const boardMoveType& move)
+{
+  boardMovesType& killers = _killers[ply];
+  if (!killers.isEmpty() && killers.first() == move) {
+    return;
+  }
+
+  killers.prepend(move);
+  if (killers.size() > 2) {
+    killers.removeLast();
+  }
+}
+
+void Search::updatePrincipalVariation(int ply, const boardMoveType& move)
+{
+  _principalVariation[ply][ply] = move;
+  int length = _principalVariationLength[ply + 1];
+  for (int next = ply + 1; next < length; ++next) {
+    _principalVariation[ply][next] = _principalVariation[ply + 1][next];
+  }
+  _principalVariationLength[ply] = qMax(length, ply + 1);
+}
+
+hashType Search::key(const boardStateMapType& state, PieceColors::ePieceColors colorToMove)
+{
+  hashType positionKey = state.hash();
+  if (colorToMove == PieceColors::eWhite) {
+    positionKey ^= BitBoards::getInstance().zobristWhiteToMove();
+  }
+  return positionKey;
+}
@@ -0,0 +1,413 @@
+///
+/// \file   Search.h
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This file contains structure definitions and members of the SearchLimits and SearchReport structs,
+/// and of the SearchListener and Search classes.
+///
+
+#ifndef SEARCH_H
+#define SEARCH_H
+
+#include "CommonTypeDefinitions.h"
+#include "GameState.h"
+#include "GameHistory.h"
+#include "TranspositionTable.h"
+
+#include <QThread>
+#include <QAtomicInt>
+#include <QElapsedTimer>
+#include <QList>
+
+///
+/// The SearchLimits struct tells a Search how long it may think, as the UCI "go" command does.
+///
+/// Every limit left at 0 is not imposed.  A Search without any limit thinks until it is stopped.
+///
+struct SearchLimits {
+
+  ///
+  /// SearchLimits is the default constructor for objects of SearchLimits, imposing no limit at all.
+  ///
+  SearchLimits();
+
+  qint64 time[PieceColors::eMax + 1];      ///< time holds the time left on the clock of each colour, in milliseconds.
+  qint64 increment[PieceColors::eMax + 1]; ///< increment holds the time added to the clock of each colour per move, in milliseconds.
+  int movesToGo;                           ///< movesToGo is the number of moves until the next time control.
+  qint64 moveTime;                         ///< moveTime is the exact time to spend on the move, in milliseconds.
+  int depth;                               ///< depth is the deepest iteration to search.
+  qint64 nodes;                            ///< nodes is the number of positions to search.
+  bool infinite;                           ///< infinite indicates the search goes on until stopped, even once it has found a mate.
+  bool ponder;                             ///< ponder indicates the search runs on the opponent's time, until Search::ponderHit() or Search::stop().
+};
+
+///
+/// The SearchReport struct describes an iteration of a Search, once it has been completed.
+///
+struct SearchReport {
+  int depth;                         ///< depth is the depth of the iteration.
+  int selectiveDepth;                ///< selectiveDepth is the largest number of moves played out along any line, captures included.
+  int score;                         ///< score is the score of the best move, in centipawns, relative to the side to move.
+  qint64 nodes;                      ///< nodes is the number of positions searched so far, by all threads.
+  qint64 time;                       ///< time is the time spent so far, in milliseconds.
+  int hashfull;                      ///< hashfull is the use of the transposition table, per thousand.
+  boardMovesType principalVariation; ///< principalVariation is the line of best play found, from the position searched.
+};
+
+///
+/// The SearchListener class is told about the progress of a Search, from the thread the Search runs in.
+///
+class SearchListener
+{
+
+public:
+
+  ///
+  /// ~SearchListener is the default destructor for objects of type SearchListener.
+  ///
+  virtual ~SearchListener() {}
+
+  ///
+  /// iterationCompleted is called each time the Search completes an iteration.
+  ///
+  /// \param report [in] describes the iteration.
+  ///
+  virtual void iterationCompleted(const SearchReport& report) = 0;
+
+  ///
+  /// searchCompleted is called once, when the Search has stopped.
+  ///
+  /// \param bestMove [in] the move to play, a default constructed move if there is no legal move.
+  /// \param ponderMove [in] the reply expected, a default constructed move if there is none.
+  ///
+  virtual void searchCompleted(const boardMoveType& bestMove, const boardMoveType& ponderMove) = 0;
+};
+
+///
+/// The Search class looks for the best move in a position, in a thread of its own.
+///
+/// The search deepens iteratively: it searches one move deep, then two, and so on, until it runs out
+/// of time or depth.  Each iteration is an alpha-beta search with a principal variation window, ending in
+/// a search of captures only, so that no score is taken in the middle of an exchange.  The best move of
+/// each position searched goes into the TranspositionTable, and is tried first in the next iteration,
+/// followed by the captures and the killer moves of the MovePicker.  Repetitions, found through a
+/// GameHistory, and the fifty-move rule score as a draw.
+///
+/// With more than one thread, the extra threads search the same position, sharing the table, and only
+/// the first thread reports.  They fill the table with results the first thread finds ready made.
+///
+/// Example usage:
+/// \code
+///  TranspositionTable table;
+///  Search search(table, &listener);
+///  search.setPosition(state, PieceColors::eWhite, history);
+///  search.go(limits); // listener.searchCompleted() is called from the search thread
+///  search.stop();
+///  search.wait();
+/// \endcode
+///
+class Search : public QThread
+{
+  Q_OBJECT
+
+public:
+
+  ///
+  /// Search is the constructor for objects of the Search class.
+  ///
+  /// \param table [in] is the table to share what is found in.  It must outlive the Search.
+  /// \param listener [in] is told about the progress of the search, may be null.  It must outlive the Search.
+  /// \param parent [in] is the parent of the Search.
+  ///
+  explicit Search(TranspositionTable& table, SearchListener* listener = 0, QObject* parent = 0);
+
+  ///
+  /// ~Search is the default destructor for objects of type Search.  It stops the search, and waits for it.
+  ///
+  virtual ~Search();
+
+  ///
+  /// setPosition sets up the position to search.  Not to be called while searching.
+  ///
+  /// \param state [in] the position.
+  /// \param colorToMove [in] the colour of the side to move.
+  /// \param history [in] the positions of the game so far, the current one last, to find repetitions in.
+  ///
+  void setPosition(const boardStateMapType& state, PieceColors::ePieceColors colorToMove, const GameHistory& history);
+
+  ///
+  /// setThreads sets the number of threads to search with.  Not to be called while searching.
+  ///
+  /// \param threads [in] the number of threads, at least 1.
+  ///
+  void setThreads(int threads);
+
+  ///
+  /// threads is an accessor method to the number of threads searched with.
+  ///
+  /// \return the number of threads, this one included.
+  ///
+  int threads() const;
+
+  ///
+  /// go starts the search of the position set up.
+  ///
+  /// \param limits [in] tells how long to search.
+  ///
+  void go(const SearchLimits& limits);
+
+  ///
+  /// stop makes the search stop as soon as possible.  The best move found so far is still reported.
+  ///
+  void stop();
+
+  ///
+  /// ponderHit tells a search that was pondering that the move it pondered on was played, so that its clock now runs.
+  ///
+  void ponderHit();
+
+  ///
+  /// nodes gives the number of positions searched, by all threads.
+  ///
+  /// \return the number of positions searched since go() was last called.
+  ///
+  qint64 nodes() const;
+
+  ///
+  /// bestMove is an accessor method to the best move of the last completed iteration.
+  ///
+  /// \return the best move, a default constructed move if none was found.
+  ///
+  boardMoveType bestMove() const;
+
+  ///
+  /// eMaxPly is the largest number of moves the search plays out along any line.
+  ///
+  static const int eMaxPly = 64;
+
+  ///
+  /// eMateScore is the score of mating right away.  Mating later scores one less per move played out.
+  ///
+  static const int eMateScore = 32000;
+
+  ///
+  /// eInfinity is a score beyond any score the search gives.
+  ///
+  static const int eInfinity = 32001;
+
+protected:
+
+  ///
+  /// run is the overridden function the thread runs, it searches until a limit is reached and reports the best move.
+  ///
+  virtual void run();
+
+private:
+
+  ///
+  /// Search is the private copy constructor, a Search is not to be copied.
+  ///
+  Search(Search const&);
+
+  ///
+  /// operator= is the private assignment operator, a Search is not to be copied.
+  ///
+  void operator=(Search const&);
+
+  ///
+  /// iterate deepens the search one iteration at a time, until a limit is reached.
+  ///
+  void iterate();
+
+  ///
+  /// alphaBeta searches a position to a given depth.
+  ///
+  /// \param state [in] the position.
+  /// \param colorToMove [in] the colour of the side to move.
+  /// \param depth [in] the number of moves left to search, captures not counted.
+  /// \param ply [in] the number of moves played out from the root.
+  /// \param alpha [in] the score the side to move is already sure of.
+  /// \param beta [in] the score the opponent is already sure of, a higher score will not be allowed.
+  /// \param nullMoveAllowed [in] indicates whether passing the move may be tried to prove the position is good enough.
+  /// \return the score of the position, relative to the side to move.
+  ///
+  int alphaBeta(boardStateMapType& state,
+                PieceColors::ePieceColors colorToMove,
+                int depth,
+                int ply,
+                int alpha,
+                int beta,
+                bool nullMoveAllowed);
+
+  ///
+  /// quiescence searches captures only, until the position is quiet, and scores it then.
+  ///
+  /// \param state [in] the position.
+  /// \param colorToMove [in] the colour of the side to move.
+  /// \param ply [in] the number of moves played out from the root.
+  /// \param alpha [in] the score the side to move is already sure of.
+  /// \param beta [in] the score the opponent is already sure of.
+  /// \return the score of the position, relative to the side to move.
+  ///
+  int quiescence(boardStateMapType& state, PieceColors::ePieceColors colorToMove, int ply, int alpha, int beta);
+
+  ///
+  /// checkLimits stops the search once it reaches its time or node limit.  Only the first thread does so.
+  ///
+  void checkLimits();
+
+  ///
+  /// isStopped determines whether the search has to stop.
+  ///
+  /// \return true if the search was stopped.
+  ///
+  inline bool isStopped() const
+  {
+    return _stopped.loadAcquire() != 0;
+  }
+
+  ///
+  /// elapsed gives the time that counts against the clock, the time spent pondering left out.
+  ///
+  /// \return the time in milliseconds.
+  ///
+  qint64 elapsed() const;
+
+  ///
+  /// storeKiller remembers a quiet move that refuted a position, to try early in the positions next to it.
+  ///
+  /// \param ply [in] the number of moves played out from the root.
+  /// \param move [in] the move.
+  ///
+  void storeKiller(int ply, const boardMoveType& move);
+
+  ///
+  /// updatePrincipalVariation makes a move, followed by the line of best play after it, the line of best play at a ply.
+  ///
+  /// \param ply [in] the number of moves played out from the root.
+  /// \param move [in] the move.
+  ///
+  void updatePrincipalVariation(int ply, const boardMoveType& move);
+
+  ///
+  /// key gives the key of a position in the transposition table, the side to move included.
+  ///
+  /// \param state [in] the position.
+  /// \param colorToMove [in] the colour of the side to move.
+  /// \return the key.
+  ///
+  static hashType key(const boardStateMapType& state, PieceColors::ePieceColors colorToMove);
+
+  ///
+  /// _table is the private member that stores the table the threads share.
+  ///
+  TranspositionTable& _table;
+
+  ///
+  /// _listener is the private member that stores the listener told about the progress, null for the extra threads.
+  ///
+  SearchListener* _listener;
+
+  ///
+  /// _helpers is the private member that stores the extra threads, searching alongside this one.
+  ///
+  QList<Search*> _helpers;
+
+  ///
+  /// _helperIndex is the private member that stores the number of this thread, 0 for the thread that reports.
+  ///
+  int _helperIndex;
+
+  ///
+  /// _rootState is the private member that stores the position to search.
+  ///
+  boardStateMapType _rootState;
+
+  ///
+  /// _rootColor is the private member that stores the colour of the side to move in the position to search.
+  ///
+  PieceColors::ePieceColors _rootColor;
+
+  ///
+  /// _history is the private member that stores the positions of the game, and of the line being searched.
+  ///
+  GameHistory _history;
+
+  ///
+  /// _limits is the private member that stores how long to search.
+  ///
+  SearchLimits _limits;
+
+  ///
+  /// _optimumTime is the private member that stores the time to aim for, 0 if there is no time limit.
+  ///
+  qint64 _optimumTime;
+
+  ///
+  /// _maximumTime is the private member that stores the time not to exceed, 0 if there is no time limit.
+  ///
+  qint64 _maximumTime;
+
+  ///
+  /// _timer is the private member that measures the time since go() was called.
+  ///
+  QElapsedTimer _timer;
+
+  ///
+  /// _stopped is the private member that indicates whether the search has to stop.
+  ///
+  QAtomicInt _stopped;
+
+  ///
+  /// _pondering is the private member that indicates whether the search runs on the opponent's time.
+  ///
+  QAtomicInt _pondering;
+
+  ///
+  /// _ponderHitTime is the private member that stores when the pondering ended, in milliseconds since go().
+  ///
+  QAtomicInt _ponderHitTime;
+
+  ///
+  /// _nodes is the private member that counts the positions searched by this thread.
+  ///
+  qint64 _nodes;
+
+  ///
+  /// _publishedNodes is the private member that makes _nodes, as of the last check, readable by other threads.
+  ///
+  QAtomicInteger<qint64> _publishedNodes;
+
+  ///
+  /// _selectiveDepth is the private member that stores the largest ply reached in the current iteration.
+  ///
+  int _selectiveDepth;
+
+  ///
+  /// _bestMove is the private member that stores the best move of the last completed iteration.
+  ///
+  boardMoveType _bestMove;
+
+  ///
+  /// _ponderMove is the private member that stores the reply expected to _bestMove.
+  ///
+  boardMoveType _ponderMove;
+
+  ///
+  /// _killers is the private member that stores, per ply, the last two quiet moves that refuted a position.
+  ///
+  boardMovesType _killers[eMaxPly];
+
+  ///
+  /// _principalVariation is the private member that stores, per ply, the line of best play found from it.
+  ///
+  boardMoveType _principalVariation[eMaxPly][eMaxPly];
+
+  ///
+  /// _principalVariationLength is the private member that stores, per ply, the ply the line of best play ends at.
+  ///
+  int _principalVariationLength[eMaxPly];
+};
+
+#endif // SEARCH_H
@@ -0,0 +1,42 @@
+///
+/// \file   Bench.h
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This file contains the declaration of the bench function of the chess-uci tool.
+///
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <QtGlobal>
+
+///
+/// eDefaultBenchDepth is the depth bench() searches to, unless told otherwise.
+///
+const int eDefaultBenchDepth = 6;
+
+///
+/// eBenchSignature is the total number of nodes bench() searches at eDefaultBenchDepth.
+///
+/// A change that is meant to change what the search does updates it along with the search, to the
+/// "Nodes searched" bench prints.  Any other change must leave it as it is.
+///
+const qint64 eBenchSignature = Q_INT64_C(7044092);
+
+///
+/// bench searches a fixed set of positions to a fixed depth, and writes the nodes, time and nodes per second to stdout.
+///
+/// Each position is searched by a single thread, with a table of the default size cleared beforehand,
+/// so the number of nodes depends on nothing but the search itself.  The total is its signature: it
+/// stays the same across compilers, flags and machines, and changes with any change to what the search
+/// does.  The nodes per second compare how fast different builds search.
+///
+/// At eDefaultBenchDepth the total is checked against eBenchSignature, and a mismatch is written out.
+///
+/// \param depth [in] the depth to search each position to.
+/// \return false if the total searched at eDefaultBenchDepth is not eBenchSignature, true otherwise.
+///
+bool bench(int depth);
+
+#endif // BENCH_H
@@ -0,0 +1,494 @@
+///
+/// \file   BoardBenchmark.cpp
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This file contains the benchmarks of the hot paths of the Board, of MoveMapper, and of the move generation
+/// and the GameState they run on.
+///
+/// Every benchmark runs on the same handful of positions, and reports, apart from the time QTest
+/// measures per iteration, the time and the number of heap allocations of a single call.  The
+/// allocations are counted as AllocationTracker counts them: with glibc the malloc family is interposed,
+/// so that the nodes Qt's containers get from malloc are counted along with whatever is allocated through
+/// operator new, elsewhere only operator new is counted.  An optimisation that only avoids copying
+/// containers therefore shows up just as clearly as one that saves time.
+///
+/// Usage:
+/// \code
+///  board-benchmark                         runs every benchmark on every position
+///  board-benchmark generate                runs a single benchmark
+///  board-benchmark generate:Kiwipete       runs a single benchmark on a single position
+/// \endcode
+///
+
+#include "Board.h"
+#include "MoveMapper.h"
+#include "LegalMoveGenerator.h"
+#include "Player.h"
+#include "BitBoards.h"
+
+#include <QtTest>
+#include <QElapsedTimer>
+#include <QImage>
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+  ///
+  /// allocations counts the heap allocations, since the program started.
+  ///
+  qint64 allocations = 0;
+
+  ///
+  /// The CallMeter class measures the time and heap allocations of the calls made during its lifetime.
+  ///
+  class CallMeter
+  {
+
+  public:
+
+    ///
+    /// CallMeter is the constructor for objects of the CallMeter class, it starts measuring.
+    ///
+    /// \param name [in] is the name of the function measured, as it is reported.
+    ///
+    explicit CallMeter(const char* name) :
+      _name(name),
+      _calls(0),
+      _allocations(allocations)
+    {
+      _timer.start();
+    }
+
+    ///
+    /// ~CallMeter is the destructor for objects of type CallMeter, it reports the time and allocations per call.
+    ///
+    ~CallMeter()
+    {
+      qint64 elapsed = _timer.nsecsElapsed();
+      qint64 allocated = allocations - _allocations;
+      qint64 calls = qMax(_calls, qint64(1));
+
+      std::printf("%s: %lld calls, %.1f ns and %.2f heap allocations per call\n",
+                  _name, static_cast<long long>(_calls), double(elapsed) / calls, double(allocated) / calls);
+    }
+
+    ///
+    /// count records calls made to the function measured.
+    ///
+    /// \param calls [in] is the number of calls made.
+    ///
+    inline void count(qint64 calls = 1)
+    {
+      _calls += calls;
+    }
+
+  private:
+
+    const char* _name;          ///< _name is the name of the function measured.
+    qint64 _calls;              ///< _calls is the number of calls made so far.
+    qint64 _allocations;        ///< _allocations is the allocation count when measuring started.
+    QElapsedTimer _timer;       ///< _timer measures the time since measuring started.
+  };
+
+  ///
+  /// The BenchmarkPosition struct names a position of the corpus.
+  ///
+  struct BenchmarkPosition {
+    const char* name; ///< name is the name of the position, as QTest shows it.
+    const char* fen;  ///< fen is the position, in Forsyth-Edwards Notation.
+  };
+
+  ///
+  /// corpus holds the positions every benchmark runs on.
+  ///
+  const BenchmarkPosition corpus[] = {
+    { "Initial",    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1" },
+    { "Kiwipete",   "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1" },
+    { "Middlegame", "r1bq1rk1/ppp1nppp/4n3/3p3Q/3P4/1BP1B3/PP1N2PP/R4RK1 w - - 1 16" },
+    { "Check",      "rnbqkbnr/ppp2ppp/3p4/1B2p3/4P3/8/PPPP1PPP/RNBQK1NR b KQkq - 1 3" },
+    { "Endgame",    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1" }
+  };
+}
+
+#if defined(__GLIBC__)
+
+// Executables take precedence over the shared libraries when symbols are resolved, so these stand in
+// for the malloc family of the C library, for Qt and for operator new alike.
+extern "C"
+{
+  void* __libc_malloc(std::size_t size);
+  void* __libc_calloc(std::size_t count, std::size_t size);
+  void* __libc_realloc(void* pointer, std::size_t size);
+
+  void* malloc(std::size_t size)
+  {
+    ++allocations;
+    return __libc_malloc(size);
+  }
+
+  void* calloc(std::size_t count, std::size_t size)
+  {
+    ++allocations;
+    return __libc_calloc(count, size);
+  }
+
+  void* realloc(void* pointer, std::size_t size)
+  {
+    ++allocations;
+    return __libc_realloc(pointer, size);
+  }
+}
+
+#else
+
+///
+/// operator new is replaced for the benchmarks, to count the heap allocations.
+///
+void* operator new(std::size_t size)
+{
+  ++allocations;
+  void* memory = std::malloc(size ? size : 1);
+  if (!memory) {
+    throw std::bad_alloc();
+  }
+  return memory;
+}
+
+///
+/// operator new[] is replaced along with operator new, to count the arrays allocated too.
+///
+void* operator new[](std::size_t size)
+{
+  return operator new(size);
+}
+
+///
+/// operator delete is replaced along with operator new, to release what it allocated.
+///
+void operator delete(void* memory) throw()
+{
+  std::free(memory);
+}
+
+///
+/// operator delete[] is replaced along with operator new[], to release what it allocated.
+///
+void operator delete[](void* memory) throw()
+{
+  std::free(memory);
+}
+
+#endif // __GLIBC__
+
+///
+/// The BoardBenchmark class holds the benchmarks, one slot each, with a _data slot to add the corpus.
+///
+class BoardBenchmark : public QObject
+{
+  Q_OBJECT
+
+public:
+
+  ///
+  /// BoardBenchmark is the default constructor for objects of the BoardBenchmark class.
+  ///
+  BoardBenchmark() :
+    _board(0),
+    _colorToMove(PieceColors::eWhite)
+  {
+
+  }
+
+private slots:
+
+  void initTestCase();
+  void cleanupTestCase();
+
+  void generate_data();
+  void generate();
+
+  void legalMoves_data();
+  void legalMoves();
+
+  void makeMove_data();
+  void makeMove();
+
+  void isInCheck_data();
+  void isInCheck();
+
+  void evaluateBoardState_data();
+  void evaluateBoardState();
+
+  void movePieceStartAndRevert_data();
+  void movePieceStartAndRevert();
+
+  void doesPlayerHaveAvailableMoves_data();
+  void doesPlayerHaveAvailableMoves();
+
+  void clearHighLights_data();
+  void clearHighLights();
+
+private:
+
+  ///
+  /// addCorpus adds a row per position of the corpus to the benchmark about to run.
+  ///
+  void addCorpus();
+
+  ///
+  /// loadRow loads the position of the current row onto the board.
+  ///
+  void loadRow();
+
+  ///
+  /// rowMoves gives the legal moves of the side to move in the position of the current row.
+  ///
+  /// \return the moves, looked up front so that only what is done with them is measured.
+  ///
+  boardMovesType rowMoves();
+
+  ///
+  /// _board is the board the benchmarks run on, with the position of the current row loaded.
+  ///
+  Board* _board;
+
+  ///
+  /// _colorToMove is the colour of the side to move in the position of the current row.
+  ///
+  PieceColors::ePieceColors _colorToMove;
+};
+
+void BoardBenchmark::initTestCase()
+{
+  BitBoards::getInstance();
+  _board = new Board();
+  MoveMapper::getInstance().associateGameBoard(_board);
+}
+
+void BoardBenchmark::cleanupTestCase()
+{
+  delete _board;
+  _board = 0;
+}
+
+void BoardBenchmark::loadRow()
+{
+  QFETCH(QString, fen);
+
+  boardStateMapType position;
+  int halfmoveClock = 0;
+  QVERIFY(position.readFen(fen.toLatin1().constData(), _colorToMove, &halfmoveClock));
+  _board->loadPosition(position, halfmoveClock);
+}
+
+void BoardBenchmark::addCorpus()
+{
+  QTest::addColumn<QString>("fen");
+  for (size_t index = 0; index < sizeof(corpus) / sizeof(corpus[0]); ++index) {
+    QTest::newRow(corpus[index].name) << QString::fromLatin1(corpus[index].fen);
+  }
+}
+
+boardMovesType BoardBenchmark::rowMoves()
+{
+  const LegalMoveTable& table = MoveMapper::getInstance().legalMoves(Board::workingBoardStateMap(), _colorToMove);
+
+  boardMovesType moves;
+  bitBoardType origins = table.origins;
+  while (origins) {
+    squareType from = BitBoards::popLowestSquare(origins);
+    bitBoardType destinations = table.destinations[from];
+    while (destinations) {
+      squareType to = BitBoards::popLowestSquare(destinations);
+      moves.append(boardMoveType(BitBoards::coordinate(from), BitBoards::coordinate(to)));
+    }
+  }
+  return moves;
+}
+
+void BoardBenchmark::generate_data()
+{
+  addCorpus();
+}
+
+void BoardBenchmark::generate()
+{
+  loadRow();
+
+  LegalMoveGenerator generator(Board::workingBoardStateMap(), _colorToMove);
+  LegalMoveTable table;
+  CallMeter meter("LegalMoveGenerator::generate");
+
+  QBENCHMARK {
+    generator.generate(table);
+    meter.count();
+  }
+}
+
+void BoardBenchmark::legalMoves_data()
+{
+  addCorpus();
+}
+
+void BoardBenchmark::legalMoves()
+{
+  loadRow();
+
+  boardStateMapType& state = Board::workingBoardStateMap();
+  CallMeter meter("MoveMapper::legalMoves");
+
+  // Asking for both sides in turn keeps MoveMapper from answering out of the moves it kept from the call before
+  QBENCHMARK {
+    MoveMapper::getInstance().legalMoves(state, _colorToMove);
+    MoveMapper::getInstance().legalMoves(state, PieceColors::flipColor(_colorToMove));
+    meter.count(2);
+  }
+}
+
+void BoardBenchmark::makeMove_data()
+{
+  addCorpus();
+}
+
+void BoardBenchmark::makeMove()
+{
+  loadRow();
+
+  const boardStateMapType& state = Board::workingBoardStateMap();
+  boardMovesType moves = rowMoves();
+  CallMeter meter("GameState::makeMove");
+
+  // Every move is played on a copy of the state, the way the search plays its moves
+  QBENCHMARK {
+    for (int index = 0; index < moves.size(); ++index) {
+      boardStateMapType next = state;
+      next.makeMove(BitBoards::square(moves.at(index).first), BitBoards::square(moves.at(index).second));
+    }
+    meter.count(moves.size());
+  }
+}
+
+void BoardBenchmark::isInCheck_data()
+{
+  addCorpus();
+}
+
+void BoardBenchmark::isInCheck()
+{
+  loadRow();
+
+  const boardStateMapType& state = Board::workingBoardStateMap();
+  CallMeter meter("GameState::isInCheck");
+
+  QBENCHMARK {
+    state.isInCheck(PieceColors::eBlack);
+    state.isInCheck(PieceColors::eWhite);
+    meter.count(2);
+  }
+}
+
+void BoardBenchmark::evaluateBoardState_data()
+{
+  addCorpus();
+}
+
+void BoardBenchmark::evaluateBoardState()
+{
+  loadRow();
+
+  boardStateMapType& state = Board::workingBoardStateMap();
+  CallMeter meter("Board::evaluateBoardState");
+
+  QBENCHMARK {
+    _board->evaluateBoardState(state, PieceColors::eBlack);
+    _board->evaluateBoardState(state, PieceColors::eWhite);
+    meter.count(2);
+  }
+}
+
+void BoardBenchmark::movePieceStartAndRevert_data()
+{
+  addCorpus();
+}
+
+void BoardBenchmark::movePieceStartAndRevert()
+{
+  loadRow();
+
+  boardStateMapType scenario = Board::workingBoardStateMap();
+  piecesListType scenarioPieces;
+  boardMovesType moves = rowMoves();
+  CallMeter meter("Board::movePieceStart + Board::movePieceRevertMove");
+
+  QBENCHMARK {
+    for (int index = 0; index < moves.size(); ++index) {
+      Board::movePieceStart(moves.at(index).first, moves.at(index).second, scenario, scenarioPieces);
+      Board::movePieceRevertMove(scenario, scenarioPieces);
+    }
+    meter.count(moves.size());
+  }
+}
+
+void BoardBenchmark::doesPlayerHaveAvailableMoves_data()
+{
+  addCorpus();
+}
+
+void BoardBenchmark::doesPlayerHaveAvailableMoves()
+{
+  loadRow();
+
+  QSharedPointer<Player> sideToMove(new Player(UserIdentity::eHuman, _colorToMove));
+  QSharedPointer<Player> opponent(new Player(UserIdentity::eComputer, PieceColors::flipColor(_colorToMove)));
+  CallMeter meter("MoveMapper::doesPlayerHaveAvailableMoves");
+
+  // Asking for both sides in turn keeps MoveMapper from answering out of the moves it kept from the call before
+  QBENCHMARK {
+    boardCoordinatesType container;
+    boardCoordinateType locationStart;
+    bool kingChecked = false;
+    MoveMapper::getInstance().doesPlayerHaveAvailableMoves(sideToMove, container, &kingChecked, locationStart);
+    MoveMapper::getInstance().doesPlayerHaveAvailableMoves(opponent, container, &kingChecked, locationStart);
+    meter.count(2);
+  }
+}
+
+void BoardBenchmark::clearHighLights_data()
+{
+  addCorpus();
+}
+
+void BoardBenchmark::clearHighLights()
+{
+  loadRow();
+
+  boardStateMapType& state = Board::workingBoardStateMap();
+  const LegalMoveTable& table = MoveMapper::getInstance().legalMoves(state, _colorToMove);
+
+  // Every square a piece of the side to move can reach is highlighted, as if all of them had been selected at once
+  boardCoordinatesType highlights;
+  for (squareType from = 0; from < 64; ++from) {
+    BitBoards::toCoordinates(table.destinations[from], highlights);
+  }
+
+  // The board is painted into an image, so that what the highlights cost to draw is measured as well
+  _board->resize(640, 640);
+  QImage image(_board->size(), QImage::Format_ARGB32_Premultiplied);
+  CallMeter meter("Board::clearHighLights");
+
+  QBENCHMARK {
+    _board->highLightCoordinates(highlights);
+    _board->render(&image);
+    _board->clearHighLights();
+    _board->render(&image);
+    meter.count();
+  }
+}
+
+QTEST_MAIN(BoardBenchmark)
+
+#include "BoardBenchmark.moc"
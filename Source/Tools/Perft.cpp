@@ -0,0 +1,148 @@
+///
+/// \file   Perft.cpp
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This file contains the perft console tool, which counts the leaf positions of the move tree.
+///
+/// The counts of a handful of well known positions are published, and every rule of Chess
+/// (castling, en passant, promotion, pins, checks) shows up in at least one of them.  A count
+/// that differs from the published one means the LegalMoveGenerator or GameState::makeMove is
+/// wrong, and the time taken makes the suite double as a benchmark of both.
+///
+/// Usage:
+/// \code
+///  perft              runs the suite, to the depth listed for each position
+///  perft <depth>      runs the suite, no deeper than <depth>
+/// \endcode
+///
+
+#include "LegalMoveGenerator.h"
+
+#include <QElapsedTimer>
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace
+{
+  ///
+  /// The PerftPosition struct pairs a position, in Forsyth-Edwards Notation, with its published leaf counts.
+  ///
+  struct PerftPosition {
+    const char* name;        ///< name is the name the position is known by.
+    const char* fen;         ///< fen is the position, in Forsyth-Edwards Notation.
+    int depth;               ///< depth is the deepest count to verify by default.
+    qint64 expected[6];      ///< expected holds the leaf count of depth 1 to depth.
+  };
+
+  ///
+  /// suite holds the positions the perft tool verifies, see https://www.chessprogramming.org/Perft_Results.  The last
+  /// one names an en passant square no pawn can have passed over, whose counts are those of the same position without it.
+  ///
+  const PerftPosition suite[] = {
+    { "Initial position",
+      "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+      5, { 20, 400, 8902, 197281, 4865609, 0 } },
+    { "Kiwipete",
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+      4, { 48, 2039, 97862, 4085603, 0, 0 } },
+    { "Position 3",
+      "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+      5, { 14, 191, 2812, 43238, 674624, 0 } },
+    { "Position 4",
+      "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+      4, { 6, 264, 9467, 422333, 0, 0 } },
+    { "Position 5",
+      "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+      4, { 44, 1486, 62379, 2103487, 0, 0 } },
+    { "Stray en passant",
+      "4k3/8/8/8/8/8/3PN3/4K3 w - e3 0 1",
+      5, { 11, 55, 655, 4286, 52284, 0 } }
+  };
+
+  ///
+  /// perft counts the leaf positions of the move tree, depth moves deep.  The last row of moves is counted, not played.
+  ///
+  qint64 perft(const GameState& state, PieceColors::ePieceColors colorToMove, int depth)
+  {
+    LegalMoveGenerator generator(state, colorToMove);
+    LegalMoveTable table;
+    generator.generate(table);
+
+    if (depth <= 1) {
+      return table.moveCount();
+    }
+
+    static const Pieces::Identities::eIdentities promotions[] = {
+      Pieces::Identities::eQueen, Pieces::Identities::eCastle, Pieces::Identities::eBishop, Pieces::Identities::eKnight
+    };
+
+    qint64 nodes = 0;
+    bitBoardType origins = table.origins;
+
+    while (origins) {
+      squareType from = BitBoards::popLowestSquare(origins);
+      bitBoardType destinations = table.destinations[from];
+      int choices = (table.promotions & BitBoards::squareBit(from)) ? 4 : 1;
+
+      while (destinations) {
+        squareType to = BitBoards::popLowestSquare(destinations);
+
+        for (int choice = 0; choice < choices; ++choice) {
+          GameState next(state);
+          next.makeMove(from, to, promotions[choice]);
+          nodes += perft(next, PieceColors::flipColor(colorToMove), depth - 1);
+        }
+      }
+    }
+    return nodes;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  int maximumDepth = argc > 1 ? std::atoi(argv[1]) : 0;
+  int failures = 0;
+  qint64 totalNodes = 0;
+  QElapsedTimer totalTimer;
+  totalTimer.start();
+
+  // Build the tables up front, so that they are not part of the first measurement
+  BitBoards::getInstance();
+
+  for (size_t index = 0; index < sizeof(suite) / sizeof(suite[0]); ++index) {
+    const PerftPosition& position = suite[index];
+    GameState state;
+    PieceColors::ePieceColors colorToMove = PieceColors::eWhite;
+
+    if (!state.readFen(position.fen, colorToMove)) {
+      std::printf("%-18s could not be read\n", position.name);
+      ++failures;
+      continue;
+    }
+
+    int depth = (maximumDepth > 0 && maximumDepth < position.depth) ? maximumDepth : position.depth;
+    for (int ply = 1; ply <= depth; ++ply) {
+      QElapsedTimer timer;
+      timer.start();
+      qint64 nodes = perft(state, colorToMove, ply);
+      qint64 elapsed = timer.elapsed();
+
+      bool passed = nodes == position.expected[ply - 1];
+      failures += passed ? 0 : 1;
+      totalNodes += nodes;
+
+      std::printf("%-18s depth %d  %12lld nodes  %7lld ms  %s\n",
+                  position.name, ply, static_cast<long long>(nodes), static_cast<long long>(elapsed),
+                  passed ? "ok" : "FAILED");
+    }
+  }
+
+  qint64 totalElapsed = totalTimer.elapsed();
+  std::printf("\n%lld nodes in %lld ms, %lld nodes per second, %d failed\n",
+              static_cast<long long>(totalNodes), static_cast<long long>(totalElapsed),
+              static_cast<long long>(totalElapsed > 0 ? totalNodes * 1000 / totalElapsed : 0), failures);
+
+  return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,446 @@
+///
+/// \file   Uci.cpp
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This file contains the chess-uci console tool, which plays through the Universal Chess Interface.
+///
+/// Tournament managers and analysis GUIs start the tool, and talk to it over stdin and stdout.  The tool
+/// understands the commands below, and reports every completed iteration of its Search on an info line.
+///
+/// \code
+///  uci                          names the engine and its options, answered by uciok
+///  isready                      answered by readyok
+///  ucinewgame                   forgets the positions searched so far
+///  setoption name Hash value <megabytes>
+///  setoption name Threads value <threads>
+///  position startpos [moves <move> ...]
+///  position fen <fen> [moves <move> ...]
+///  go [wtime <ms>] [btime <ms>] [winc <ms>] [binc <ms>] [movestogo <moves>]
+///     [movetime <ms>] [depth <plies>] [nodes <nodes>] [infinite] [ponder]
+///  stop                         answered by bestmove
+///  ponderhit                    the move pondered on was played, the clock now runs
+///  quit
+///  bench [depth]                searches a fixed set of positions, see bench()
+/// \endcode
+///
+/// Started as "chess-uci bench [depth]", the tool runs the bench command and exits.  At the default depth
+/// it exits with a failure if the nodes searched are not the signature, see eBenchSignature, so that a
+/// change to what the search does cannot slip by unnoticed.
+///
+
+#include "Bench.h"
+#include "Search.h"
+#include "LegalMoveGenerator.h"
+#include "BitBoards.h"
+
+#include <QMutex>
+#include <QMutexLocker>
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace
+{
+  ///
+  /// startPosition is the position a game starts in, in Forsyth-Edwards Notation.
+  ///
+  const char* const startPosition = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+  ///
+  /// eMaxThreads is the largest number of threads the Threads option may be given.
+  ///
+  const int eMaxThreads = 64;
+
+  ///
+  /// outputMutex keeps the lines written by the search thread and the main thread from running into each other.
+  ///
+  QMutex outputMutex;
+
+  ///
+  /// send writes a line to the GUI, and flushes it out right away.
+  ///
+  void send(const std::string& line)
+  {
+    QMutexLocker locker(&outputMutex);
+    std::fputs(line.c_str(), stdout);
+    std::fputc('\n', stdout);
+    std::fflush(stdout);
+  }
+
+  ///
+  /// moveText gives a move in the long algebraic notation UCI uses, e.g. "e2e4", or "e7e8q" for a promotion.
+  ///
+  std::string moveText(const boardStateMapType& state, const boardMoveType& move)
+  {
+    if (move == boardMoveType()) {
+      return "0000";
+    }
+
+    std::string text;
+    text += char('a' + move.first.second - 1);
+    text += char('0' + 9 - move.first.first);
+    text += char('a' + move.second.second - 1);
+    text += char('0' + 9 - move.second.first);
+
+    const definedPieceType& piece = state.pieceOn(BitBoards::square(move.first));
+    if (piece.first == Pieces::Identities::ePawn &&
+        (BitBoards::promotionRow(piece.second) & BitBoards::squareBit(BitBoards::square(move.second))) != 0) {
+      switch (move.promotion) {
+      case Pieces::Identities::eCastle :
+        text += 'r';
+        break;
+      case Pieces::Identities::eBishop :
+        text += 'b';
+        break;
+      case Pieces::Identities::eKnight :
+        text += 'n';
+        break;
+      default                          :
+        text += 'q';
+        break;
+      }
+    }
+    return text;
+  }
+
+  ///
+  /// readMove finds the legal move a move in long algebraic notation stands for.
+  ///
+  bool readMove(const boardStateMapType& state,
+                PieceColors::ePieceColors colorToMove,
+                const std::string& text,
+                squareType& from,
+                squareType& to,
+                Pieces::Identities::eIdentities& promotion)
+  {
+    if (text.size() < 4 || text.size() > 5 ||
+        text[0] < 'a' || text[0] > 'h' || text[1] < '1' || text[1] > '8' ||
+        text[2] < 'a' || text[2] > 'h' || text[3] < '1' || text[3] > '8') {
+      return false;
+    }
+
+    from = BitBoards::square(boardCoordinateType(9 - (text[1] - '0'), text[0] - 'a' + 1));
+    to = BitBoards::square(boardCoordinateType(9 - (text[3] - '0'), text[2] - 'a' + 1));
+
+    // Only a pawn reaching the last row is promoted, so only its move may name a piece
+    const definedPieceType& piece = state.pieceOn(from);
+    bool promoting = piece.first == Pieces::Identities::ePawn &&
+                     (BitBoards::promotionRow(piece.second) & BitBoards::squareBit(to)) != 0;
+    if (text.size() == 5 && !promoting) {
+      return false;
+    }
+
+    promotion = Pieces::Identities::eQueen;
+    if (text.size() == 5) {
+      switch (text[4]) {
+      case 'q' :
+        promotion = Pieces::Identities::eQueen;
+        break;
+      case 'r' :
+        promotion = Pieces::Identities::eCastle;
+        break;
+      case 'b' :
+        promotion = Pieces::Identities::eBishop;
+        break;
+      case 'n' :
+        promotion = Pieces::Identities::eKnight;
+        break;
+      default  :
+        return false;
+      }
+    }
+
+    LegalMoveGenerator generator(state, colorToMove);
+    return (generator.destinationsFrom(from) & BitBoards::squareBit(to)) != 0;
+  }
+
+  ///
+  /// The UciListener class writes the progress of the Search out as UCI info and bestmove lines.
+  ///
+  class UciListener : public SearchListener
+  {
+
+  public:
+
+    ///
+    /// setRoot sets the position being searched, to write the moves of the principal variation in.
+    ///
+    void setRoot(const boardStateMapType& state)
+    {
+      _rootState = state;
+    }
+
+    ///
+    /// iterationCompleted writes an info line, with the score in centipawns or in moves to mate.
+    ///
+    virtual void iterationCompleted(const SearchReport& report)
+    {
+      std::ostringstream line;
+      line << "info depth " << report.depth << " seldepth " << report.selectiveDepth;
+
+      int mateScore = Search::eMateScore - Search::eMaxPly;
+      if (report.score >= mateScore) {
+        line << " score mate " << (Search::eMateScore - report.score + 1) / 2;
+      }
+      else if (report.score <= -mateScore) {
+        // A root with no legal move is mated already, reported as mate 0 rather than mate -0
+        line << " score mate " << -((Search::eMateScore + report.score) / 2);
+      }
+      else {
+        line << " score cp " << report.score;
+      }
+
+      line << " nodes " << report.nodes
+           << " nps " << report.nodes * 1000 / qMax(report.time, qint64(1))
+           << " hashfull " << report.hashfull
+           << " time " << report.time
+           << " pv";
+
+      boardStateMapType state(_rootState);
+      for (int index = 0; index < report.principalVariation.size(); ++index) {
+        const boardMoveType& move = report.principalVariation.at(index);
+        line << ' ' << moveText(state, move);
+        state.makeMove(BitBoards::square(move.first), BitBoards::square(move.second), move.promotion);
+      }
+
+      send(line.str());
+    }
+
+    ///
+    /// searchCompleted writes the bestmove line, with the move to ponder on if there is one.
+    ///
+    virtual void searchCompleted(const boardMoveType& bestMove, const boardMoveType& ponderMove)
+    {
+      std::string line = "bestmove " + moveText(_rootState, bestMove);
+
+      if (bestMove != boardMoveType() && ponderMove != boardMoveType()) {
+        boardStateMapType state(_rootState);
+        state.makeMove(BitBoards::square(bestMove.first), BitBoards::square(bestMove.second), bestMove.promotion);
+        line += " ponder " + moveText(state, ponderMove);
+      }
+      send(line);
+    }
+
+  private:
+
+    ///
+    /// _rootState is the private member that stores the position being searched.
+    ///
+    boardStateMapType _rootState;
+  };
+
+  ///
+  /// setUpPosition handles the position command, playing the moves listed out from the position given.
+  ///
+  bool setUpPosition(std::istringstream& tokens,
+                     boardStateMapType& state,
+                     PieceColors::ePieceColors& colorToMove,
+                     GameHistory& history)
+  {
+    std::string token;
+    std::string fen;
+    tokens >> token;
+
+    if (token == "startpos") {
+      fen = startPosition;
+      tokens >> token;
+    }
+    else if (token == "fen") {
+      while (tokens >> token && token != "moves") {
+        fen += (fen.empty() ? "" : " ") + token;
+      }
+    }
+    else {
+      return false;
+    }
+
+    boardStateMapType position;
+    PieceColors::ePieceColors color = PieceColors::eWhite;
+    int halfmoveClock = 0;
+    if (!position.readFen(fen.c_str(), color, &halfmoveClock)) {
+      return false;
+    }
+
+    GameHistory positions;
+    positions.reset(position.hash(), halfmoveClock);
+
+    while (token == "moves" && tokens >> token) {
+      squareType from;
+      squareType to;
+      Pieces::Identities::eIdentities promotion;
+      if (!readMove(position, color, token, from, to, promotion)) {
+        return false;
+      }
+
+      bool pawnMove = position.pieceOn(from).first == Pieces::Identities::ePawn;
+      definedPieceType taken = position.makeMove(from, to, promotion);
+      positions.push(position.hash(), pawnMove || taken.first != Pieces::Identities::eNone);
+      color = PieceColors::flipColor(color);
+      token = "moves";
+    }
+
+    state = position;
+    colorToMove = color;
+    history = positions;
+    return true;
+  }
+
+  ///
+  /// readLimits handles the arguments of the go command.
+  ///
+  SearchLimits readLimits(std::istringstream& tokens)
+  {
+    SearchLimits limits;
+    std::string token;
+
+    while (tokens >> token) {
+      if (token == "wtime") {
+        tokens >> limits.time[PieceColors::eWhite];
+      }
+      else if (token == "btime") {
+        tokens >> limits.time[PieceColors::eBlack];
+      }
+      else if (token == "winc") {
+        tokens >> limits.increment[PieceColors::eWhite];
+      }
+      else if (token == "binc") {
+        tokens >> limits.increment[PieceColors::eBlack];
+      }
+      else if (token == "movestogo") {
+        tokens >> limits.movesToGo;
+      }
+      else if (token == "movetime") {
+        tokens >> limits.moveTime;
+      }
+      else if (token == "depth") {
+        tokens >> limits.depth;
+      }
+      else if (token == "nodes") {
+        tokens >> limits.nodes;
+      }
+      else if (token == "infinite") {
+        limits.infinite = true;
+      }
+      else if (token == "ponder") {
+        limits.ponder = true;
+      }
+    }
+    return limits;
+  }
+
+  ///
+  /// setOption handles the setoption command.
+  ///
+  void setOption(std::istringstream& tokens, TranspositionTable& table, Search& search)
+  {
+    std::string token;
+    std::string name;
+    std::string value;
+
+    tokens >> token;
+    while (tokens >> token && token != "value") {
+      name += (name.empty() ? "" : " ") + token;
+    }
+    tokens >> value;
+
+    if (name == "Hash") {
+      table.resize(std::atoi(value.c_str()));
+    }
+    else if (name == "Threads") {
+      search.setThreads(qBound(1, std::atoi(value.c_str()), eMaxThreads));
+    }
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  // Build the tables up front, so that the first search does not pay for them
+  BitBoards::getInstance();
+
+  if (argc > 1 && std::string(argv[1]) == "bench") {
+    int depth = argc > 2 ? std::atoi(argv[2]) : eDefaultBenchDepth;
+    return bench(depth > 0 ? depth : eDefaultBenchDepth) ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+
+  TranspositionTable table;
+  UciListener listener;
+  Search search(table, &listener);
+
+  boardStateMapType state;
+  PieceColors::ePieceColors colorToMove = PieceColors::eWhite;
+  GameHistory history;
+  state.readFen(startPosition, colorToMove);
+  history.reset(state.hash());
+
+  std::string line;
+  while (std::getline(std::cin, line)) {
+    std::istringstream tokens(line);
+    std::string command;
+    tokens >> command;
+
+    if (command == "uci") {
+      std::ostringstream options;
+      options << "option name Hash type spin default " << TranspositionTable::eDefaultMegabytes
+              << " min 1 max " << TranspositionTable::eMaxMegabytes << '\n'
+              << "option name Threads type spin default 1 min 1 max " << eMaxThreads << '\n'
+              << "option name Ponder type check default false";
+
+      send("id name ChessRevisited");
+      send("id author ChessRevisited contributors");
+      send(options.str());
+      send("uciok");
+    }
+    else if (command == "isready") {
+      send("readyok");
+    }
+    else if (command == "ucinewgame") {
+      search.stop();
+      search.wait();
+      table.clear();
+    }
+    else if (command == "setoption") {
+      search.stop();
+      search.wait();
+      setOption(tokens, table, search);
+    }
+    else if (command == "position") {
+      search.stop();
+      search.wait();
+      if (!setUpPosition(tokens, state, colorToMove, history)) {
+        send("info string invalid position");
+      }
+    }
+    else if (command == "go") {
+      search.stop();
+      search.wait();
+      listener.setRoot(state);
+      search.setPosition(state, colorToMove, history);
+      search.go(readLimits(tokens));
+    }
+    else if (command == "stop") {
+      search.stop();
+      search.wait();
+    }
+    else if (command == "ponderhit") {
+      search.ponderHit();
+    }
+    else if (command == "bench") {
+      search.stop();
+      search.wait();
+      int depth = eDefaultBenchDepth;
+      tokens >> depth;
+      bench(depth > 0 ? depth : eDefaultBenchDepth);
+    }
+    else if (command == "quit") {
+      break;
+    }
+  }
+
+  search.stop();
+  search.wait();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,172 @@
+///
+/// \file   TranspositionTable.cpp
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This file contains the inner management features of the TranspositionTable class.
+///
+/// In this cpp file what is known about a position is packed into a single word, so that a slot is
+/// no more than two words: the key, and the data.
+///
+
+#include "TranspositionTable.h"
+#include "BitBoards.h"
+
+namespace
+{
+  ///
+  /// The bit layout of the data word: the move squares, whether there is a move, the promotion, the score, the depth,
+  /// the bound and the generation.
+  ///
+  const int eFromShift       = 0;
+  const int eToShift         = 6;
+  const int eHasMoveShift    = 12;
+  const int ePromotionShift  = 13;
+  const int eScoreShift      = 16;
+  const int eDepthShift      = 32;
+  const int eBoundShift      = 40;
+  const int eGenerationShift = 42;
+
+  ///
+  /// eScoreOffset keeps the stored score positive, scores range from -eScoreOffset to eScoreOffset - 1.
+  ///
+  const int eScoreOffset = 32768;
+
+  ///
+  /// eGenerations is the number of searches the generation counts before it wraps around, it is kept in six bits.
+  ///
+  const int eGenerations = 64;
+
+  ///
+  /// eSampleSize is the number of slots hashfull() looks at.
+  ///
+  const int eSampleSize = 1000;
+
+  inline int field(quint64 data, int shift, int bits)
+  {
+    return int((data >> shift) & ((Q_UINT64_C(1) << bits) - 1));
+  }
+}
+
+TranspositionTable::TranspositionTable(int megabytes) :
+  _slots(),
+  _mask(0),
+  _megabytes(0),
+  _generation(1)
+{
+  resize(megabytes);
+}
+
+TranspositionTable::~TranspositionTable()
+{
+
+}
+
+void TranspositionTable::resize(int megabytes)
+{
+  if (megabytes < 1) {
+    megabytes = 1;
+  }
+  if (megabytes > eMaxMegabytes) {
+    megabytes = eMaxMegabytes;
+  }
+
+  quint64 slotCount = 1;
+  while (slotCount * 2 * sizeof(Slot) <= quint64(megabytes) * 1024 * 1024) {
+    slotCount *= 2;
+  }
+
+  _slots.clear();
+  _slots.resize(int(slotCount));
+  _mask = slotCount - 1;
+  _megabytes = megabytes;
+  clear();
+}
+
+int TranspositionTable::megabytes() const
+{
+  return _megabytes;
+}
+
+void TranspositionTable::clear()
+{
+  Slot empty;
+  empty.check = 0;
+  empty.data = 0;
+  _slots.fill(empty);
+  _generation = 1;
+}
+
+void TranspositionTable::newSearch()
+{
+  // Generation 0 is kept for slots that were never written
+  _generation = _generation + 1 < eGenerations ? _generation + 1 : 1;
+}
+
+bool TranspositionTable::probe(hashType key, Probe& found) const
+{
+  const Slot& slot = _slots.at(int(key & _mask));
+  quint64 data = slot.data;
+
+  if (data == 0 || (slot.check ^ data) != key) {
+    return false;
+  }
+
+  if (field(data, eHasMoveShift, 1)) {
+    found.move = boardMoveType(BitBoards::coordinate(field(data, eFromShift, 6)),
+                               BitBoards::coordinate(field(data, eToShift, 6)),
+                               Pieces::Identities::eIdentities(field(data, ePromotionShift, 3)));
+  }
+  else {
+    found.move = boardMoveType();
+  }
+  found.score = field(data, eScoreShift, 16) - eScoreOffset;
+  found.depth = field(data, eDepthShift, 8);
+  found.bound = eBounds(field(data, eBoundShift, 2));
+  return true;
+}
+
+void TranspositionTable::store(hashType key, const boardMoveType& move, int score, int depth, eBounds bound)
+{
+  Slot& slot = _slots[int(key & _mask)];
+  quint64 old = slot.data;
+  bool samePosition = old != 0 && (slot.check ^ old) == key;
+
+  // A shallower search of another position from this very search is not worth the slot
+  if (!samePosition && old != 0 &&
+      field(old, eGenerationShift, 6) == _generation && field(old, eDepthShift, 8) > depth) {
+    return;
+  }
+
+  quint64 data = 0;
+  if (move != boardMoveType()) {
+    data |= quint64(BitBoards::square(move.first)) << eFromShift;
+    data |= quint64(BitBoards::square(move.second)) << eToShift;
+    data |= Q_UINT64_C(1) << eHasMoveShift;
+    data |= quint64(move.promotion) << ePromotionShift;
+  }
+  else if (samePosition) {
+    data |= old & ((Q_UINT64_C(1) << (ePromotionShift + 3)) - 1);
+  }
+
+  data |= quint64(qBound(0, score + eScoreOffset, 2 * eScoreOffset - 1)) << eScoreShift;
+  data |= quint64(qBound(0, depth, 255)) << eDepthShift;
+  data |= quint64(bound) << eBoundShift;
+  data |= quint64(_generation) << eGenerationShift;
+
+  slot.check = key ^ data;
+  slot.data = data;
+}
+
+int TranspositionTable::hashfull() const
+{
+  int sample = qMin(eSampleSize, _slots.size());
+  int used = 0;
+  for (int index = 0; index < sample; ++index) {
+    quint64 data = _slots.at(index).data;
+    if (data != 0 && field(data, eGenerationShift, 6) == _generation) {
+      ++used;
+    }
+  }
+  return sample > 0 ? used * 1000 / sample : 0;
+}
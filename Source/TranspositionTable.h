@@ -0,0 +1,167 @@
+///
+/// \file   TranspositionTable.h
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This file contains structure definitions and members of the TranspositionTable class.
+///
+
+#ifndef TRANSPOSITIONTABLE_H
+#define TRANSPOSITIONTABLE_H
+
+#include "CommonTypeDefinitions.h"
+
+#include <QVector>
+
+///
+/// The TranspositionTable class remembers what a search found out about the positions it visited, keyed by their Zobrist key.
+///
+/// A position is often reached by more than one order of moves.  Once it has been searched, the table
+/// gives back the best move found, the score and how deep it was searched, so that the next visit can
+/// either stop right away or at least try the best move first.
+///
+/// The table is a power of two of slots, and a key always goes to the same slot.  A slot is taken over by
+/// a deeper search of another position, or by any search once its own is from an earlier move of the game.
+/// Each slot holds its key exclusive-ored with its data, so that several searching threads can share one
+/// table without locks: a slot torn by two threads writing at once no longer matches its key, and is
+/// simply not found.
+///
+/// Example usage:
+/// \code
+///  TranspositionTable table(16);
+///  table.newSearch();
+///  TranspositionTable::Probe probe;
+///  if (table.probe(key, probe) && probe.depth >= depth) { ... }
+///  table.store(key, bestMove, score, depth, TranspositionTable::eExactBound);
+/// \endcode
+///
+class TranspositionTable
+{
+
+public:
+
+  ///
+  /// The eBounds enum tells how a score stored in the table relates to the true score of the position.
+  ///
+  enum eBounds {
+    eNoBound    = 0, ///< enum value eNoBound means the slot holds a move, but no usable score.
+    eUpperBound = 1, ///< enum value eUpperBound means no move reached the score, the true score is at most this.
+    eLowerBound = 2, ///< enum value eLowerBound means a move refuted the position, the true score is at least this.
+    eExactBound = 3  ///< enum value eExactBound means the score is the true score, to the depth searched.
+  };
+
+  ///
+  /// The Probe struct holds what the table knows about a position.
+  ///
+  struct Probe {
+    boardMoveType move; ///< move is the best move found, a default constructed move if there was none.
+    int score;          ///< score is the score found, relative to the side to move.
+    int depth;          ///< depth is the depth the position was searched to.
+    eBounds bound;      ///< bound tells how score relates to the true score.
+  };
+
+  ///
+  /// TranspositionTable is the constructor for objects of the TranspositionTable class.
+  ///
+  /// \param megabytes [in] is the size of the table, see resize().
+  ///
+  explicit TranspositionTable(int megabytes = eDefaultMegabytes);
+
+  ///
+  /// ~TranspositionTable is the default destructor for objects of type TranspositionTable.
+  ///
+  virtual ~TranspositionTable();
+
+  ///
+  /// resize replaces the table by an empty one of about the given size.
+  ///
+  /// \param megabytes [in] is the size of the table, rounded down to a power of two of slots, and kept between 1 and eMaxMegabytes.
+  ///
+  void resize(int megabytes);
+
+  ///
+  /// megabytes is an accessor method to the size of the table.
+  ///
+  /// \return the size the table was last given.
+  ///
+  int megabytes() const;
+
+  ///
+  /// clear forgets every position, as for a new game.
+  ///
+  void clear();
+
+  ///
+  /// newSearch marks the start of the search of a new move, so that the slots of earlier searches are given up first.
+  ///
+  void newSearch();
+
+  ///
+  /// probe looks a position up.
+  ///
+  /// \param key [in] the key of the position, side to move included.
+  /// \param found [out] what is known about the position, only valid when true is returned.
+  /// \return true if the position is in the table.
+  ///
+  bool probe(hashType key, Probe& found) const;
+
+  ///
+  /// store records what a search found out about a position.
+  ///
+  /// \param key [in] the key of the position, side to move included.
+  /// \param move [in] the best move found, or a default constructed move to keep the one already stored.
+  /// \param score [in] the score found, relative to the side to move.
+  /// \param depth [in] the depth the position was searched to.
+  /// \param bound [in] tells how score relates to the true score.
+  ///
+  void store(hashType key, const boardMoveType& move, int score, int depth, eBounds bound);
+
+  ///
+  /// hashfull estimates how much of the table is used by the current search, as UCI reports it.
+  ///
+  /// \return the number of slots, per thousand, written since newSearch() was last called.
+  ///
+  int hashfull() const;
+
+  ///
+  /// eDefaultMegabytes is the size of a table, unless told otherwise.
+  ///
+  static const int eDefaultMegabytes = 16;
+
+  ///
+  /// eMaxMegabytes is the largest size a table may be given.
+  ///
+  static const int eMaxMegabytes = 1024;
+
+private:
+
+  ///
+  /// The Slot struct is one slot of the table.  The data packs the move, score, depth, bound and generation.
+  ///
+  struct Slot {
+    hashType check; ///< check is the key of the position exclusive-ored with data.
+    quint64 data;   ///< data is what is known about the position, packed into one word.
+  };
+
+  ///
+  /// _slots is the private member that stores the slots, a power of two of them.
+  ///
+  QVector<Slot> _slots;
+
+  ///
+  /// _mask is the private member that maps a key onto a slot, the number of slots minus one.
+  ///
+  hashType _mask;
+
+  ///
+  /// _megabytes is the private member that stores the size the table was last given.
+  ///
+  int _megabytes;
+
+  ///
+  /// _generation is the private member that stores the number of the current search, wrapping around.
+  ///
+  int _generation;
+};
+
+#endif // TRANSPOSITIONTABLE_H
@@ -10,12 +10,13 @@
 ///
 
 #include "TurnManager.h"
+#include "AllocationTracker.h"
+#include "TurnTracer.h"
 
 #include <QSharedPointer>
 #include <QApplication>
 
 QSharedPointer<Player> TurnManager::_currentPlayer = QSharedPointer<Player>();
-AppFilter* TurnManager::_filter = new AppFilter();
 
 TurnManager::TurnManager(QObject* parent) : QObject(parent)
 {
@@ -29,36 +30,72 @@ QSharedPointer<Player>& TurnManager::currentPlayer()
 
 void TurnManager::switchPlayers(QSharedPointer<Player>& toWhichPlayer)
 {
+  TRACE_SCOPE("TurnManager::switchPlayers");
+
   if (_currentPlayer == 0) {
     _currentPlayer = toWhichPlayer;
   }
   if (_currentPlayer->identity() != toWhichPlayer->identity()) {
     _currentPlayer = toWhichPlayer;
+    beginTurn();
+  }
+}
+
+void TurnManager::startTurn(QSharedPointer<Player>& toWhichPlayer)
+{
+  _currentPlayer = toWhichPlayer;
+  beginTurn();
+}
+
+void TurnManager::beginTurn()
+{
+  TRACE_SCOPE("TurnManager::beginTurn");
+  TRACE_INSTANT(_currentPlayer->identity() == UserIdentity::eHuman ? "Human turn begins" : "AI turn begins");
+
+#ifdef CHESS_TRACK_ALLOCATIONS
+  // Everything allocated from here on is counted for the turn that begins
+  AllocationTracker::getInstance().completeTurn(_currentPlayer->associatedColor());
+#endif
+
+  boardStateMapType& state = Board::workingBoardStateMap();
+  LegalMoveGenerator generator(state, _currentPlayer->associatedColor());
+  EndGameConditions::eEndGameConditions reason = EndGameConditions::eNone;
 
+  // Check if the game is over, stopping at the first legal move rather than mapping them all
+  if (state.isInsufficientMaterial()) {
+    reason = EndGameConditions::eInsufficientMaterial;
+  }
+  else if (!generator.hasLegalMove()) {
+    reason = generator.isInCheck() ? EndGameConditions::eCheckMate : EndGameConditions::eStaleMate;
+  }
+  else if (Board::gameHistory().isThreefoldRepetition()) {
+    reason = EndGameConditions::eThreefoldRepetition;
+  }
+  else if (Board::gameHistory().isFiftyMoveDraw()) {
+    reason = EndGameConditions::eFiftyMoveRule;
+  }
+
+  if (reason == EndGameConditions::eNone) {
     boardCoordinatesType containerOfAvailableMoves;
     boardCoordinateType startLocation;
     bool kingIsChecked = false;
 
-    // Check if the game is over
-    if (MoveMapper::getInstance().doesPlayerHaveAvailableMoves(_currentPlayer, containerOfAvailableMoves, &kingIsChecked, startLocation)) {
+    MoveMapper::getInstance().doesPlayerHaveAvailableMoves(_currentPlayer, containerOfAvailableMoves, &kingIsChecked, startLocation);
 
-      if (toWhichPlayer->identity() == UserIdentity::eHuman) {
-        QApplication::restoreOverrideCursor();
-        QApplication::instance()->removeEventFilter(_filter);
-      }
-      else {
-        QApplication::instance()->installEventFilter(_filter);
-        QApplication::setOverrideCursor(Qt::WaitCursor);
-      }
-
-      emit getInstance().turnChanged(_currentPlayer, containerOfAvailableMoves, kingIsChecked);
-    }
-    else
-    {
+    // The AI thinks in a thread of its own, so the human Player may go on queueing premoves meanwhile
+    if (_currentPlayer->identity() == UserIdentity::eHuman) {
       QApplication::restoreOverrideCursor();
-      QApplication::instance()->removeEventFilter(_filter);
-      emit getInstance().endGame(kingIsChecked);
     }
+    else {
+      QApplication::setOverrideCursor(Qt::BusyCursor);
+    }
+
+    emit getInstance().turnChanged(_currentPlayer, containerOfAvailableMoves, kingIsChecked);
+  }
+  else
+  {
+    QApplication::restoreOverrideCursor();
+    emit getInstance().endGame(reason);
   }
 }
 
@@ -10,8 +10,8 @@
 #define TURNMANAGER_H
 
 #include "Player.h"
-#include "AppFilter.h"
 #include "MoveMapper.h"
+#include "EndGameConditions.h"
 
 #include <QObject>
 
@@ -55,6 +55,15 @@ public:
   ///
   static void switchPlayers(QSharedPointer<Player>& toWhichPlayer);
 
+  ///
+  /// startTurn starts a Player's turn, whoever's turn it was, e.g. after a position has been loaded.
+  ///
+  /// Just like switchPlayers, the position is first checked for the end of the game.
+  ///
+  /// \param toWhichPlayer a shared pointer to the Player whose turn it is.
+  ///
+  static void startTurn(QSharedPointer<Player>& toWhichPlayer);
+
 signals:
 
   ///
@@ -69,9 +78,9 @@ signals:
   ///
   /// endGame disables the Board and displayes a message.
   ///
-  /// \param checkMate bool indicating if a king was checked when the game ended.
+  /// \param reason the condition that ended the game.
   ///
-  void endGame(bool checkMate);
+  void endGame(EndGameConditions::eEndGameConditions reason);
 
 public slots:
 
@@ -107,9 +116,9 @@ private:
   void setCurrentPlayer(const QSharedPointer<Player>& currentPlayer);
 
   ///
-  /// _filter is an event filtering object used to ignore all user input when it is the AI's turn to move.
+  /// beginTurn checks whether the game is over, and if not, notifies the Players that _currentPlayer's turn has started.
   ///
-  static AppFilter* _filter;
+  static void beginTurn();
 };
 
 #endif // TURNMANAGER_H
@@ -0,0 +1,131 @@
+///
+/// \file   TurnTracer.cpp
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This cpp file contains the body functionality of the TurnTracer class.
+///
+/// Times are written in microseconds with three decimals, as the trace-event format wants them.
+///
+
+#include "TurnTracer.h"
+
+#include <QDir>
+#include <QMutexLocker>
+#include <QThread>
+
+#include <cstdio>
+
+TurnTracer::TurnTracer() :
+  _eventsWritten(0)
+{
+  QByteArray fileName = qgetenv("CHESS_TRACE_FILE");
+  _file.setFileName(fileName.isEmpty() ? QDir::current().filePath(QString("turns.trace.json")) : QString::fromLocal8Bit(fileName));
+
+  if (_file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text)) {
+    char header[160];
+    std::snprintf(header, sizeof(header),
+                  "[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"Chess\"}},\n"
+                  "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%llu,\"args\":{\"name\":\"GUI\"}}",
+                  static_cast<unsigned long long>(quintptr(QThread::currentThreadId())));
+    _file.write(header);
+    _eventsWritten = 2;
+  }
+
+  _events.reserve(eBatchSize);
+  _clock.start();
+}
+
+TurnTracer::~TurnTracer()
+{
+  QMutexLocker locker(&_mutex);
+  writeEvents();
+
+  if (_file.isOpen()) {
+    _file.write("\n]\n");
+    _file.close();
+  }
+}
+
+qint64 TurnTracer::now() const
+{
+  return _clock.nsecsElapsed();
+}
+
+void TurnTracer::complete(const char* name, qint64 start)
+{
+  Event event = { name, 'X', start, now() - start, 0, quintptr(QThread::currentThreadId()) };
+  record(event);
+}
+
+void TurnTracer::instant(const char* name)
+{
+  Event event = { name, 'i', now(), 0, 0, quintptr(QThread::currentThreadId()) };
+  record(event);
+}
+
+void TurnTracer::asyncBegin(const char* name, qint64 id)
+{
+  Event event = { name, 'b', now(), 0, id, quintptr(QThread::currentThreadId()) };
+  record(event);
+}
+
+void TurnTracer::asyncEnd(const char* name, qint64 id)
+{
+  Event event = { name, 'e', now(), 0, id, quintptr(QThread::currentThreadId()) };
+  record(event);
+}
+
+void TurnTracer::record(const Event& event)
+{
+  QMutexLocker locker(&_mutex);
+  _events.append(event);
+
+  if (_events.size() >= eBatchSize) {
+    writeEvents();
+  }
+}
+
+void TurnTracer::writeEvents()
+{
+  if (!_file.isOpen()) {
+    _events.clear();
+    return;
+  }
+
+  char line[256];
+  for (int index = 0; index < _events.size(); ++index) {
+    const Event& event = _events.at(index);
+    const char* separator = _eventsWritten > 0 ? ",\n" : "";
+    unsigned long long thread = static_cast<unsigned long long>(event.thread);
+    long long start = static_cast<long long>(event.start);
+
+    switch (event.phase) {
+    case 'X' : {
+      long long duration = static_cast<long long>(event.duration);
+      std::snprintf(line, sizeof(line),
+                    "%s{\"name\":\"%s\",\"cat\":\"turn\",\"ph\":\"X\",\"pid\":1,\"tid\":%llu,\"ts\":%lld.%03lld,\"dur\":%lld.%03lld}",
+                    separator, event.name, thread, start / 1000, start % 1000, duration / 1000, duration % 1000);
+      break;
+    }
+    case 'i' : {
+      std::snprintf(line, sizeof(line),
+                    "%s{\"name\":\"%s\",\"cat\":\"turn\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":%llu,\"ts\":%lld.%03lld}",
+                    separator, event.name, thread, start / 1000, start % 1000);
+      break;
+    }
+    default  : {
+      std::snprintf(line, sizeof(line),
+                    "%s{\"name\":\"%s\",\"cat\":\"turn\",\"ph\":\"%c\",\"id\":%lld,\"pid\":1,\"tid\":%llu,\"ts\":%lld.%03lld}",
+                    separator, event.name, event.phase, static_cast<long long>(event.id), thread, start / 1000, start % 1000);
+      break;
+    }
+    }
+
+    _file.write(line);
+    ++_eventsWritten;
+  }
+
+  _events.clear();
+  _file.flush();
+}
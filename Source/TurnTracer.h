@@ -0,0 +1,237 @@
+///
+/// \file   TurnTracer.h
+/// \author agent (agent@local)
+/// \date   October 2026
+///
+/// This file contains structure definitions and members of the TurnTracer class.
+///
+/// The tracer is only switched on in builds configured with "CONFIG+=turn_tracing", which defines
+/// CHESS_TRACE_TURNS.  In any other build the TRACE_ macros expand to nothing.
+///
+
+#ifndef TURNTRACER_H
+#define TURNTRACER_H
+
+#include <QElapsedTimer>
+#include <QFile>
+#include <QMutex>
+#include <QVector>
+
+///
+/// The TurnTracer class records where the wall-clock time of a turn goes, as a Chrome trace-event file.
+///
+/// Trace points are scopes, instants and asynchronous spans, kept in memory and written out in batches,
+/// so that a trace point costs no more than reading the clock and appending to a vector.  The file is a
+/// JSON array of trace events that chrome://tracing and ui.perfetto.dev open as a timeline, one track per
+/// thread, scopes stacked by nesting.
+///
+/// The file is named by the CHESS_TRACE_FILE environment variable, or is turns.trace.json in the working
+/// directory.  It is only complete once the tracer is destroyed at exit, though both viewers also open a
+/// file cut short.
+///
+/// Example usage:
+/// \code
+///  void Board::moveInitiated(boardCoordinateType fromWhere)
+///  {
+///    TRACE_SCOPE("Board::moveInitiated");
+///    ...
+///  }
+/// \endcode
+///
+class TurnTracer
+{
+
+public:
+
+  ///
+  /// getInstance returns an instance reference, as the constructor is private.  Singleton Pattern.
+  ///
+  /// \return an instance reference to the static object of class TurnTracer.
+  ///
+  static TurnTracer& getInstance()
+  {
+    static TurnTracer instance;
+    return instance;
+  }
+
+  ///
+  /// ~TurnTracer writes out what is left of the trace, and closes the file.
+  ///
+  virtual ~TurnTracer();
+
+  ///
+  /// now returns the time since tracing started.
+  ///
+  /// \return the time in nanoseconds.
+  ///
+  qint64 now() const;
+
+  ///
+  /// complete records a scope that began at the given time, and ends now.
+  ///
+  /// \param name [in] is the name of the scope, a string literal, as only the pointer is kept.
+  /// \param start [in] is the time the scope began, as returned by now().
+  ///
+  void complete(const char* name, qint64 start);
+
+  ///
+  /// instant records a point in time, e.g. the start of a turn.
+  ///
+  /// \param name [in] is the name of the instant, a string literal.
+  ///
+  void instant(const char* name);
+
+  ///
+  /// asyncBegin records the beginning of a span that may end in another call or thread, e.g. a timer.
+  ///
+  /// \param name [in] is the name of the span, a string literal.
+  /// \param id [in] tells the span apart from others of the same name, and is handed to asyncEnd() as well.
+  ///
+  void asyncBegin(const char* name, qint64 id);
+
+  ///
+  /// asyncEnd records the end of a span begun by asyncBegin().
+  ///
+  /// \param name [in] is the name of the span, as handed to asyncBegin().
+  /// \param id [in] is the id of the span, as handed to asyncBegin().
+  ///
+  void asyncEnd(const char* name, qint64 id);
+
+private:
+
+  ///
+  /// The eConstants enum houses the sizes of the batches the trace is written out in.
+  ///
+  enum eConstants {
+    eBatchSize = 512 ///< enum value eBatchSize is the number of events kept in memory before they are written out.
+  };
+
+  ///
+  /// The Event struct holds a trace event until it is written out.
+  ///
+  struct Event {
+    const char* name;   ///< name is the name of the event.
+    char phase;         ///< phase is the trace-event phase: 'X' for a scope, 'i' for an instant, 'b' and 'e' for a span.
+    qint64 start;       ///< start is the time the event began, in nanoseconds.
+    qint64 duration;    ///< duration is how long a scope lasted, in nanoseconds.
+    qint64 id;          ///< id tells spans of the same name apart.
+    quintptr thread;    ///< thread is the thread the event was recorded on.
+  };
+
+  ///
+  /// TurnTracer is the constructor for objects of the TurnTracer class.  It opens the file and starts the clock.
+  ///
+  TurnTracer();
+
+  ///
+  /// TurnTracer is the copy constructor for objects of the TurnTracer class.  Private to enforce Singleton.
+  ///
+  TurnTracer(const TurnTracer&);
+
+  ///
+  /// operator = is the assignment operator for objects of the TurnTracer class.  Private to enforce Singleton.
+  ///
+  void operator = (const TurnTracer&);
+
+  ///
+  /// record keeps an event, and writes out the batch once it is full.
+  ///
+  /// \param event [in] is the event to keep.
+  ///
+  void record(const Event& event);
+
+  ///
+  /// writeEvents writes out the events kept so far.  The caller holds _mutex.
+  ///
+  void writeEvents();
+
+  ///
+  /// _clock is the private member that measures the time since tracing started.
+  ///
+  QElapsedTimer _clock;
+
+  ///
+  /// _file is the private member that holds the trace file.
+  ///
+  QFile _file;
+
+  ///
+  /// _events is the private member that holds the events not yet written out.
+  ///
+  QVector<Event> _events;
+
+  ///
+  /// _eventsWritten is the private member that counts the events written out, to separate them by commas.
+  ///
+  qint64 _eventsWritten;
+
+  ///
+  /// _mutex is the private member that serializes the threads recording events.
+  ///
+  QMutex _mutex;
+};
+
+///
+/// The TraceScope class records the time from its construction to its destruction, as a scope of the trace.
+///
+class TraceScope
+{
+
+public:
+
+  ///
+  /// TraceScope is the constructor for objects of the TraceScope class.  It notes the time the scope begins.
+  ///
+  /// \param name [in] is the name of the scope, a string literal.
+  ///
+  explicit TraceScope(const char* name) :
+    _name(name),
+    _start(TurnTracer::getInstance().now())
+  {
+
+  }
+
+  ///
+  /// ~TraceScope records the scope, ending now.
+  ///
+  ~TraceScope()
+  {
+    TurnTracer::getInstance().complete(_name, _start);
+  }
+
+private:
+
+  ///
+  /// TraceScope is the copy constructor for objects of the TraceScope class.  Private, as a scope cannot be shared.
+  ///
+  TraceScope(const TraceScope&);
+
+  ///
+  /// operator = is the assignment operator for objects of the TraceScope class.  Private, as a scope cannot be shared.
+  ///
+  void operator = (const TraceScope&);
+
+  ///
+  /// _name is the private member that holds the name of the scope.
+  ///
+  const char* _name;
+
+  ///
+  /// _start is the private member that holds the time the scope began.
+  ///
+  qint64 _start;
+};
+
+#ifdef CHESS_TRACE_TURNS
+#define TRACE_SCOPE(name)           TraceScope traceScope(name)
+#define TRACE_INSTANT(name)         TurnTracer::getInstance().instant(name)
+#define TRACE_ASYNC_BEGIN(name, id) TurnTracer::getInstance().asyncBegin(name, id)
+#define TRACE_ASYNC_END(name, id)   TurnTracer::getInstance().asyncEnd(name, id)
+#else
+#define TRACE_SCOPE(name)
+#define TRACE_INSTANT(name)
+#define TRACE_ASYNC_BEGIN(name, id)
+#define TRACE_ASYNC_END(name, id)
+#endif
+
+#endif // TURNTRACER_H
@@ -1,4 +1,5 @@
 #include "Chess.h"
+#include "BitBoards.h"
 #include <QApplication>
 
 ///
@@ -10,6 +11,10 @@
 int main(int argc, char* argv[])
 {
   QApplication a(argc, argv);
+
+  // Build the precomputed square tables once, before the first move is ever mapped
+  BitBoards::getInstance();
+
   Chess w;
   w.show();
 